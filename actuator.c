@@ -32,15 +32,298 @@
 
 #include "actuator.h"
 
+#include "config.h"
+#include "journal.h"
+
 #include <string.h> /* memset(), memcpy() */
 
 #include "hardware/gpio.h" /* gpio_init(), gpio_set_dir(), gpio_put() */
-#include "pico/time.h" /* time_us_64() */
+#include "hardware/sync.h" /* save_and_disable_interrupts(), restore_interrupts() */
+#include "pico/time.h" /* time_us_64(), alarm_pool_*() */
+
+/* The host build has no PIO */
+#if LIB_HARDWARE_PIO
+#include "actuator.pio.h"
+#include "hardware/pio.h"
+#endif
+
+enum actuator_phase_t
+{
+    ACTUATOR_PHASE_IDLE,
+    ACTUATOR_PHASE_EXTEND,
+    ACTUATOR_PHASE_RETRACT,
+};
+
+/** Actuators driven by the CPU backend, their outputs are all written together by actuator_outputs_sync() */
+static struct
+{
+    struct actuator_t* actuators[ACTUATOR_MAX_CPU];
+    size_t count;
+    /** Levels last written to the pins of actuator_outputs::actuators (Bit n is GPIO n) */
+    uint64_t value;
+    struct actuator_output_stats_t stats;
+} actuator_outputs;
+
+#if ACTUATOR_ALARM_EDGES
+/** Alarm pool of the core that initialized the first actuator, so that the alarm IRQ is handled on that core */
+static alarm_pool_t* actuator_alarm_pool;
+#endif
+
+#if LIB_HARDWARE_PIO
+/** Whether actuator_program is loaded in each PIO instance, every actuator on an instance shares one copy */
+static bool actuator_pio_loaded[NUM_PIOS];
+/** Offset of actuator_program in each PIO instance */
+static uint actuator_pio_offsets[NUM_PIOS];
+
+/**
+ * Start a PIO state machine for an actuator, loading actuator_program if no instance has it (and a free state machine)
+ *
+ * @returns True on success, False if the actuator can't be driven by PIO
+ */
+static bool actuator_pio_init(struct actuator_t* const a)
+{
+    if (a->conf.gpio_retract != a->conf.gpio_extend + 1 || a->conf.time_rest <= actuator_PHASE_OVERHEAD
+        || a->conf.time_travel <= actuator_PHASE_OVERHEAD || a->conf.time_rest > UINT32_MAX || a->conf.time_travel > UINT32_MAX)
+        return false;
+
+    /* Prefer instances that already have the program */
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (uint i = 0; i < NUM_PIOS; i++)
+        {
+            PIO pio = pio_get_instance(i);
+            if (actuator_pio_loaded[i] != (pass == 0))
+                continue;
+            const int sm = pio_claim_unused_sm(pio, false);
+            if (sm < 0)
+                continue;
+            if (!actuator_pio_loaded[i])
+            {
+                if (!pio_can_add_program(pio, &actuator_program))
+                {
+                    pio_sm_unclaim(pio, sm);
+                    continue;
+                }
+                actuator_pio_offsets[i] = pio_add_program(pio, &actuator_program);
+                actuator_pio_loaded[i] = true;
+            }
 
-void actuator_init(struct actuator_t* const a, const struct actuator_config_t* const conf)
+            a->pio_index = i;
+            a->pio_sm = sm;
+            actuator_program_init(pio, sm, actuator_pio_offsets[i], a->conf.gpio_extend, !a->conf.logic_active_level_extend,
+                !a->conf.logic_active_level_retract, a->conf.time_rest, a->conf.time_travel);
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Check if the state machine of an actuator has finished its last retract */
+static bool actuator_pio_done(const struct actuator_t* const a) { return pio_interrupt_get(pio_get_instance(a->pio_index), a->pio_sm); }
+#endif
+
+/**
+ * Get the times (in microseconds since boot) at which the outputs of an actuator change
+ *
+ * Phases are exclusive of their start time (see actuator_phase()), so active phases begin 1 us after their start
+ * timestamp, and the outputs go idle exactly at the end timestamp
+ */
+static void actuator_transitions(const struct actuator_t* const a, uint64_t t[4])
 {
+    t[0] = a->timestamp_start_extend + 1;
+    t[1] = a->timestamp_end_extend;
+    t[2] = a->timestamp_start_retract + 1;
+    t[3] = a->timestamp_end_retract;
+}
+
+static enum actuator_phase_t actuator_phase(const struct actuator_t* const a, const uint64_t cur)
+{
+    if (a->timestamp_start_retract < cur && cur < a->timestamp_end_retract)
+        return ACTUATOR_PHASE_RETRACT;
+    if (a->timestamp_start_extend < cur && cur < a->timestamp_end_extend)
+        return ACTUATOR_PHASE_EXTEND;
+    return ACTUATOR_PHASE_IDLE;
+}
+
+/** Estimate the extension (in microseconds of travel) of an actuator at cur, see actuator_get_position() */
+static uint64_t actuator_position(const struct actuator_t* const a, const uint64_t cur)
+{
+    int64_t position = (int64_t)a->position_start;
+    if (cur > a->timestamp_start_extend)
+        position += (int64_t)((cur < a->timestamp_end_extend ? cur : a->timestamp_end_extend) - a->timestamp_start_extend);
+    if (position > (int64_t)a->conf.time_travel)
+        position = (int64_t)a->conf.time_travel;
+    if (cur > a->timestamp_start_retract)
+        position -= (int64_t)((cur < a->timestamp_end_retract ? cur : a->timestamp_end_retract) - a->timestamp_start_retract);
+    return position < 0 ? 0 : (uint64_t)position;
+}
+
+/** Time (in microseconds) to retract for to get home from an estimated position */
+static uint64_t actuator_retract_time(const struct actuator_t* const a, const uint64_t position)
+{
+    /* A full travel gets home from anywhere */
+    const uint64_t t = position + a->conf.time_margin;
+    return t < a->conf.time_travel ? t : a->conf.time_travel;
+}
+
+/** Record how late the phase change of an actuator at cur was, measured from the transition that caused it */
+static void actuator_record_jitter(struct actuator_t* const a, const uint64_t cur)
+{
+    uint64_t t[4];
+    actuator_transitions(a, t);
+    uint64_t due = 0;
+    for (int i = 0; i < 4; i++)
+        if (t[i] <= cur && t[i] > due)
+            due = t[i];
+    const uint64_t late = cur - due;
+    a->jitter.last_us = late > UINT32_MAX ? UINT32_MAX : (uint32_t)late;
+    if (a->jitter.last_us > a->jitter.max_us)
+        a->jitter.max_us = a->jitter.last_us;
+    a->jitter.total_us += a->jitter.last_us;
+    a->jitter.edges++;
+}
+
+/**
+ * Bring the outputs of every CPU backend actuator up to date
+ *
+ * The level of every relay pin is computed and compared to the level last written, only the pins that differ are
+ * written, and all of them in a single gpio_put_masked64(). Both pins of an actuator (and the pins of different
+ * actuators) therefore always switch together.
+ *
+ * Must be called with interrupts disabled (or from the alarm IRQ)
+ */
+static void actuator_outputs_sync(const uint64_t cur)
+{
+    uint64_t value = actuator_outputs.value;
+    for (size_t i = 0; i < actuator_outputs.count; i++)
+    {
+        struct actuator_t* const a = actuator_outputs.actuators[i];
+        const enum actuator_phase_t phase = actuator_phase(a, cur);
+        if (phase != a->phase)
+        {
+            if (a->phase == ACTUATOR_PHASE_EXTEND)
+                a->usage.extend_us += cur - a->timestamp_phase;
+            else if (a->phase == ACTUATOR_PHASE_RETRACT)
+                a->usage.retract_us += cur - a->timestamp_phase;
+            a->phase = phase;
+            a->timestamp_phase = cur;
+            actuator_record_jitter(a, cur);
+#if JOURNAL_ENABLE
+            journal_record(JOURNAL_ACTUATOR_PHASE, a->conf.gpio_extend, phase, a->jitter.last_us, cur);
+#endif
+        }
+
+        const bool retract = phase == ACTUATOR_PHASE_RETRACT ? a->conf.logic_active_level_retract : !a->conf.logic_active_level_retract;
+        const bool extend = phase == ACTUATOR_PHASE_EXTEND ? a->conf.logic_active_level_extend : !a->conf.logic_active_level_extend;
+        value = (value & ~(1ull << a->conf.gpio_retract)) | ((uint64_t)retract << a->conf.gpio_retract);
+        value = (value & ~(1ull << a->conf.gpio_extend)) | ((uint64_t)extend << a->conf.gpio_extend);
+    }
+
+    /* Every actuator used to be written with two gpio_put() calls on every poll */
+    const uint64_t changed = value ^ actuator_outputs.value;
+    actuator_outputs.stats.syncs++;
+    actuator_outputs.stats.writes_avoided += actuator_outputs.count * 2 - (changed ? 1 : 0);
+    if (!changed)
+        return;
+    gpio_put_masked64(changed, value);
+    actuator_outputs.value = value;
+    actuator_outputs.stats.writes++;
+}
+
+/** @returns Time (in microseconds since boot) of the first output change after cur, or UINT64_MAX if there is none */
+static uint64_t actuator_next_transition(const struct actuator_t* const a, const uint64_t cur)
+{
+    uint64_t t[4];
+    actuator_transitions(a, t);
+    uint64_t next = UINT64_MAX;
+    for (int i = 0; i < 4; i++)
+        if (cur < t[i] && t[i] < next)
+            next = t[i];
+    return next;
+}
+
+#if ACTUATOR_ALARM_EDGES
+static int64_t actuator_alarm_callback(alarm_id_t id, void* user_data)
+{
+    (void)id;
+    struct actuator_t* const a = user_data;
+    const uint64_t cur = time_us_64();
+    actuator_outputs_sync(cur);
+
+    const uint64_t next = actuator_next_transition(a, cur);
+    if (next == UINT64_MAX)
+    {
+        a->alarm = 0;
+        return 0;
+    }
+    /* Negative return values are relative to the previous target (positive ones to when the callback returns), so the
+     * alarm doesn't accumulate the IRQ and callback latency */
+    const int64_t delay = (int64_t)(next - a->alarm_target);
+    a->alarm_target = next;
+    return -delay;
+}
+#endif
+
+/**
+ * Arm the alarm for the next output change
+ *
+ * Must be called with interrupts disabled
+ */
+static void actuator_schedule(struct actuator_t* const a, const uint64_t cur)
+{
+#if ACTUATOR_ALARM_EDGES
+    if (!actuator_alarm_pool)
+        return;
+    if (a->alarm > 0)
+        alarm_pool_cancel_alarm(actuator_alarm_pool, a->alarm);
+    a->alarm = 0;
+
+    const uint64_t next = actuator_next_transition(a, cur);
+    if (next == UINT64_MAX)
+        return;
+    a->alarm_target = next;
+    /* The callback runs from the alarm IRQ once interrupts are restored, even if next has already passed */
+    const alarm_id_t id = alarm_pool_add_alarm_at(actuator_alarm_pool, from_us_since_boot(next), actuator_alarm_callback, a, true);
+    if (id > 0)
+        a->alarm = id;
+#else
+    (void)a;
+    (void)cur;
+#endif
+}
+
+bool actuator_init(struct actuator_t* const a, const struct actuator_config_t* const conf)
+{
+#if ACTUATOR_ALARM_EDGES
+    /* Without a pool, actuator_poll() does all the work */
+    if (!actuator_alarm_pool)
+        actuator_alarm_pool = alarm_pool_create_with_unused_hardware_alarm(PICO_TIME_DEFAULT_ALARM_POOL_MAX_TIMERS);
+#endif
+
     memset(a, 0, sizeof(*a));
     memcpy(&a->conf, conf, sizeof(*conf));
+
+#if LIB_HARDWARE_PIO
+    if (a->conf.backend == ACTUATOR_BACKEND_PIO && actuator_pio_init(a))
+    {
+        /* The state machine always starts with a full retract */
+        a->backend = ACTUATOR_BACKEND_PIO;
+        a->position_start = a->conf.time_travel;
+        a->usage.retract_us += a->conf.time_travel;
+        a->timestamp_start_retract = time_us_64();
+        a->timestamp_end_retract = a->timestamp_start_retract + a->conf.time_travel;
+        return true;
+    }
+#endif
+
+    /* Re-initializing an actuator (eg. after a reboot on the host) must not register it twice */
+    size_t slot = 0;
+    while (slot < actuator_outputs.count && actuator_outputs.actuators[slot] != a)
+        slot++;
+    if (slot == ACTUATOR_MAX_CPU)
+        return false;
+
+    a->backend = ACTUATOR_BACKEND_CPU;
     gpio_init(a->conf.gpio_retract);
     gpio_init(a->conf.gpio_extend);
     gpio_set_dir(a->conf.gpio_retract, GPIO_OUT);
@@ -48,44 +331,161 @@ void actuator_init(struct actuator_t* const a, const struct actuator_config_t* c
     gpio_put(a->conf.gpio_retract, !a->conf.logic_active_level_retract);
     gpio_put(a->conf.gpio_extend, !a->conf.logic_active_level_extend);
 
-    a->timestamp_start_retract = time_us_64();
-    a->timestamp_end_retract = a->timestamp_start_retract + a->conf.time_travel;
-    actuator_poll(a);
+    const uint32_t irq = save_and_disable_interrupts();
+    const uint64_t pins = (1ull << a->conf.gpio_retract) | (1ull << a->conf.gpio_extend);
+    actuator_outputs.value &= ~pins;
+    actuator_outputs.value |= (uint64_t)!a->conf.logic_active_level_retract << a->conf.gpio_retract;
+    actuator_outputs.value |= (uint64_t)!a->conf.logic_active_level_extend << a->conf.gpio_extend;
+    actuator_outputs.actuators[slot] = a;
+    if (slot == actuator_outputs.count)
+        actuator_outputs.count++;
+
+    /* Unknown positions are assumed fully extended, a known retracted position needs no retract at all */
+    const bool known = a->conf.initial_position >= 0;
+    a->position_start = known ? (uint64_t)a->conf.initial_position : a->conf.time_travel;
+    if (a->position_start > a->conf.time_travel)
+        a->position_start = a->conf.time_travel;
+    if (a->position_start > 0)
+    {
+        const uint64_t cur = time_us_64();
+        a->timestamp_start_retract = cur + a->conf.time_init_delay;
+        a->timestamp_end_retract = a->timestamp_start_retract + (known ? actuator_retract_time(a, a->position_start) : a->conf.time_travel);
+        actuator_schedule(a, cur);
+    }
+    restore_interrupts(irq);
+    return true;
 }
 
 bool actuator_in_cycle(const struct actuator_t* const a)
 {
     const uint64_t cur = time_us_64();
+#if LIB_HARDWARE_PIO
+    if (a->backend == ACTUATOR_BACKEND_PIO && !actuator_pio_done(a))
+        return true;
+#endif
     return cur < a->timestamp_end_retract || cur < a->timestamp_end_extend;
 }
 
-void actuator_poll(struct actuator_t* const a)
+uint64_t actuator_next_edge(const struct actuator_t* const a)
 {
     const uint64_t cur = time_us_64();
-    if (a->timestamp_start_retract < cur && cur < a->timestamp_end_retract)
-    {
-        gpio_put(a->conf.gpio_retract, a->conf.logic_active_level_retract);
-        gpio_put(a->conf.gpio_extend, !a->conf.logic_active_level_extend);
-    }
-    else if (a->timestamp_start_extend < cur && cur < a->timestamp_end_extend)
-    {
-        gpio_put(a->conf.gpio_retract, !a->conf.logic_active_level_retract);
-        gpio_put(a->conf.gpio_extend, a->conf.logic_active_level_extend);
-    }
-    else
-    {
-        gpio_put(a->conf.gpio_retract, !a->conf.logic_active_level_retract);
-        gpio_put(a->conf.gpio_extend, !a->conf.logic_active_level_extend);
-    }
+#if LIB_HARDWARE_PIO
+    /* The state machine can finish a few cycles after the computed end of the retract */
+    if (a->backend == ACTUATOR_BACKEND_PIO && !actuator_pio_done(a) && cur >= a->timestamp_end_retract)
+        return cur;
+#endif
+    const uint64_t edges[] = { a->timestamp_start_extend, a->timestamp_end_extend, a->timestamp_start_retract, a->timestamp_end_retract };
+    uint64_t next = UINT64_MAX;
+    for (size_t i = 0; i < sizeof(edges) / sizeof(*edges); i++)
+        if (cur <= edges[i] && edges[i] < next)
+            next = edges[i];
+    return next;
 }
 
-void actuator_trigger(struct actuator_t* const a)
+void actuator_poll(struct actuator_t* const a)
 {
-    if (actuator_in_cycle(a))
+    if (a->backend != ACTUATOR_BACKEND_CPU)
         return;
-    a->timestamp_start_extend = time_us_64() + a->conf.time_rest;
-    a->timestamp_end_extend = a->timestamp_start_extend + a->conf.time_travel;
+    actuator_poll_all();
+}
+
+void actuator_poll_all(void)
+{
+    const uint32_t irq = save_and_disable_interrupts();
+    actuator_outputs_sync(time_us_64());
+    restore_interrupts(irq);
+}
+
+void actuator_get_output_stats(struct actuator_output_stats_t* const out)
+{
+    const uint32_t irq = save_and_disable_interrupts();
+    *out = actuator_outputs.stats;
+    restore_interrupts(irq);
+}
+
+void actuator_get_jitter(const struct actuator_t* const a, struct actuator_jitter_t* const out)
+{
+    const uint32_t irq = save_and_disable_interrupts();
+    *out = a->jitter;
+    restore_interrupts(irq);
+}
+
+void actuator_get_usage(const struct actuator_t* const a, struct actuator_usage_t* const out)
+{
+    const uint32_t irq = save_and_disable_interrupts();
+    *out = a->usage;
+    /* PIO actuators are accounted for a whole cycle at a time by actuator_trigger() */
+    if (a->backend == ACTUATOR_BACKEND_CPU && a->phase == ACTUATOR_PHASE_EXTEND)
+        out->extend_us += time_us_64() - a->timestamp_phase;
+    else if (a->backend == ACTUATOR_BACKEND_CPU && a->phase == ACTUATOR_PHASE_RETRACT)
+        out->retract_us += time_us_64() - a->timestamp_phase;
+    restore_interrupts(irq);
+}
+
+/**
+ * Compute the timestamps of an extend-retract cycle triggered at cur
+ *
+ * @param extend Time (in microseconds) to extend for
+ * @param retract Time (in microseconds) to retract for
+ */
+static void actuator_set_cycle(struct actuator_t* const a, const uint64_t cur, const uint64_t extend, const uint64_t retract)
+{
+    a->position_start = actuator_position(a, cur);
+    a->timestamp_start_extend = cur + a->conf.time_rest;
+    a->timestamp_end_extend = a->timestamp_start_extend + extend;
     a->timestamp_start_retract = a->timestamp_end_extend + a->conf.time_rest;
-    a->timestamp_end_retract = a->timestamp_start_retract + a->conf.time_travel;
-    actuator_poll(a);
+    a->timestamp_end_retract = a->timestamp_start_retract + retract;
+}
+
+uint64_t actuator_get_position(const struct actuator_t* const a)
+{
+    const uint32_t irq = save_and_disable_interrupts();
+    const uint64_t position = actuator_position(a, time_us_64());
+    restore_interrupts(irq);
+    return position;
+}
+
+bool actuator_trigger_after(struct actuator_t* const a, const uint64_t not_before)
+{
+    if (actuator_in_cycle(a))
+        return false;
+#if LIB_HARDWARE_PIO
+    if (a->backend == ACTUATOR_BACKEND_PIO)
+    {
+        /* The state machine starts as soon as it is told to */
+        if (not_before > time_us_64())
+            return false;
+        PIO pio = pio_get_instance(a->pio_index);
+        pio_interrupt_clear(pio, a->pio_sm);
+        pio_sm_put(pio, a->pio_sm, 0);
+        actuator_set_cycle(a, time_us_64(), a->conf.time_travel, a->conf.time_travel);
+        a->usage.cycles++;
+        a->usage.extend_us += a->conf.time_travel;
+        a->usage.retract_us += a->conf.time_travel;
+#if JOURNAL_ENABLE
+        journal_record(JOURNAL_ACTUATOR_TRIGGER, a->conf.gpio_extend, 0, (uint32_t)a->conf.time_travel, time_us_64());
+#endif
+        return true;
+    }
+#endif
+    const uint32_t irq = save_and_disable_interrupts();
+    const uint64_t cur = time_us_64();
+    const uint64_t start = not_before > cur ? not_before : cur;
+    /* Finish the previous cycle first, so its last change is measured against its own timestamps */
+    actuator_outputs_sync(cur);
+    /* Only extend as far as the switch needs, and only retract as far as the actuator went (plus the margin) */
+    const uint64_t position = actuator_position(a, start);
+    const uint64_t stroke = a->conf.time_stroke ? a->conf.time_stroke : a->conf.time_travel;
+    const uint64_t extend = stroke > position ? stroke - position : 0;
+    actuator_set_cycle(a, start, extend, actuator_retract_time(a, position + extend));
+    a->usage.cycles++;
+#if JOURNAL_ENABLE
+    journal_record(JOURNAL_ACTUATOR_TRIGGER, a->conf.gpio_extend, 0, (uint32_t)extend, cur);
+#endif
+    actuator_outputs_sync(cur);
+    actuator_schedule(a, cur);
+    restore_interrupts(irq);
+    return true;
 }
+
+void actuator_trigger(struct actuator_t* const a) { actuator_trigger_after(a, 0); }
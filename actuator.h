@@ -34,6 +34,20 @@
 #include <stdbool.h> /* bool */
 #include <stdint.h> /* uint64_t, uint8_t */
 
+#include "pico/time.h" /* alarm_id_t */
+
+/** Maximum number of actuators using @ref ACTUATOR_BACKEND_CPU */
+#define ACTUATOR_MAX_CPU 8
+
+/** How the outputs of an actuator are driven */
+enum actuator_backend_t
+{
+    /** GPIO writes from actuator_poll() (and the timer alarm with @ref ACTUATOR_ALARM_EDGES) */
+    ACTUATOR_BACKEND_CPU,
+    /** A PIO state machine plays the whole extend-retract cycle, requires the retract pin to follow the extend pin */
+    ACTUATOR_BACKEND_PIO,
+};
+
 struct actuator_config_t
 {
     uint64_t time_travel; ///< Time (in microseconds) for full actuator travel
@@ -45,6 +59,43 @@ struct actuator_config_t
     bool logic_active_level_retract;
     /** Logic level that must be put to `gpio_extend` for actuator extension to occur */
     bool logic_active_level_extend;
+
+    /** Requested backend, actuator_init() falls back to @ref ACTUATOR_BACKEND_CPU if it can't be used */
+    enum actuator_backend_t backend;
+
+    /** Time (in microseconds) of extension needed to operate the switch, 0 for a full `time_travel` */
+    uint64_t time_stroke;
+    /** Time (in microseconds) to keep retracting past the estimated position, so that actuators slower than the estimate still reach home */
+    uint64_t time_margin;
+    /** Estimated extension (in microseconds of travel) at init, negative if unknown (A full retract is done) */
+    int64_t initial_position;
+    /** Time (in microseconds) to wait before the retract on init, to stagger actuators (@ref ACTUATOR_BACKEND_CPU only) */
+    uint64_t time_init_delay;
+};
+
+/** Lateness of output changes, measured from the time the change was due */
+struct actuator_jitter_t
+{
+    uint32_t edges; ///< Number of output changes measured
+    uint32_t last_us; ///< Lateness (in microseconds) of the last output change
+    uint32_t max_us; ///< Largest lateness (in microseconds) of any output change
+    uint64_t total_us; ///< Sum of the lateness (in microseconds) of every output change
+};
+
+/** Counters of the output stage shared by every @ref ACTUATOR_BACKEND_CPU actuator */
+struct actuator_output_stats_t
+{
+    uint32_t syncs; ///< Number of times the outputs were brought up to date
+    uint32_t writes; ///< Number of gpio_put_masked64() calls made
+    uint64_t writes_avoided; ///< Number of gpio_put() calls avoided compared to writing both pins of every actuator on every sync
+};
+
+/** Usage of an actuator since actuator_init() */
+struct actuator_usage_t
+{
+    uint32_t cycles; ///< Number of extend-retract cycles triggered
+    uint64_t extend_us; ///< Time (in microseconds) the extend output was energized
+    uint64_t retract_us; ///< Time (in microseconds) the retract output was energized (Including the retract on init)
 };
 
 struct actuator_t
@@ -54,35 +105,132 @@ struct actuator_t
     uint64_t timestamp_end_extend;
     uint64_t timestamp_start_retract;
     uint64_t timestamp_end_retract;
+    /** Estimated extension (in microseconds of travel) at the start of the current/last cycle */
+    uint64_t position_start;
+
+    /** Phase currently put to the GPIO pins (0: Idle, 1: Extending, 2: Retracting) */
+    uint8_t phase;
+    /** Time (in microseconds since boot) actuator_t::phase was put to the GPIO pins */
+    uint64_t timestamp_phase;
+    struct actuator_usage_t usage;
+    /** Alarm that applies the next output change (0 if none is pending) */
+    alarm_id_t alarm;
+    /** Time (in microseconds since boot) that actuator_t::alarm was set for */
+    uint64_t alarm_target;
+    /** Only measured with @ref ACTUATOR_BACKEND_CPU, PIO outputs switch on exact cycle counts */
+    struct actuator_jitter_t jitter;
+
+    /** Backend in use */
+    enum actuator_backend_t backend;
+    /** PIO instance number and state machine (@ref ACTUATOR_BACKEND_PIO only) */
+    uint8_t pio_index;
+    uint8_t pio_sm;
 };
 
 /**
  * Initialize an actuator
  *
- * NOTE: This will trigger a retract event to occur
+ * NOTE: This will trigger a retract event to occur, unless actuator_config_t::initial_position is known to be retracted
+ *
+ * Check actuator_t::backend afterwards to see if the requested backend is in use
  *
  * @param a Actuator object to initialize
  * @param conf Configuration for actuator
+ *
+ * @returns True on success, False if @ref ACTUATOR_MAX_CPU other actuators already use @ref ACTUATOR_BACKEND_CPU
  */
-void actuator_init(struct actuator_t* const a, const struct actuator_config_t* const conf);
+bool actuator_init(struct actuator_t* const a, const struct actuator_config_t* const conf);
 
 /**
  * Check if actuator is currently in an extend-retract cycle
  */
 bool actuator_in_cycle(const struct actuator_t* const a);
 
+/**
+ * Estimate how far an actuator is extended
+ *
+ * The estimate integrates the time that the extend/retract outputs are energized, clamped to the travel range. After
+ * every retract it is exactly 0, as the retract runs past the estimated position by actuator_config_t::time_margin.
+ *
+ * With @ref ACTUATOR_BACKEND_PIO every cycle is a full stroke, and only the estimate is available
+ *
+ * @returns Extension (in microseconds of travel, 0 is fully retracted)
+ */
+uint64_t actuator_get_position(const struct actuator_t* const a);
+
+/**
+ * Get the next time the outputs of an actuator change
+ *
+ * An edge at the current time is still returned, as actuator_poll() only applies it once that time has passed
+ *
+ * @returns Time (in microseconds since boot) of the next output change, or UINT64_MAX if the actuator is idle
+ */
+uint64_t actuator_next_edge(const struct actuator_t* const a);
+
 /**
  * Synchronize actuator state to hardware
  *
+ * With @ref ACTUATOR_ALARM_EDGES the outputs are normally already switched by a timer alarm, and this only catches
+ * changes that the alarm missed
+ *
+ * NOTE: Outputs of @ref ACTUATOR_BACKEND_CPU actuators are written together, so this updates every one of them
+ *
  * @param a Actuator to update
  */
 void actuator_poll(struct actuator_t* const a);
 
+/**
+ * Synchronize the state of every @ref ACTUATOR_BACKEND_CPU actuator to hardware
+ *
+ * Only pins whose level changed are written, all in a single masked write
+ */
+void actuator_poll_all(void);
+
+/**
+ * Get the counters of the output stage
+ *
+ * @param out Output counters
+ */
+void actuator_get_output_stats(struct actuator_output_stats_t* const out);
+
+/**
+ * Get the output change lateness statistics of an actuator
+ *
+ * @param a Actuator to read
+ * @param out Output statistics
+ */
+void actuator_get_jitter(const struct actuator_t* const a, struct actuator_jitter_t* const out);
+
+/**
+ * Get the usage of an actuator since actuator_init()
+ *
+ * Energized times include the phase in progress
+ *
+ * @param a Actuator to read
+ * @param out Output usage
+ */
+void actuator_get_usage(const struct actuator_t* const a, struct actuator_usage_t* const out);
+
 /**
  * Trigger an extend-retract cycle
  *
+ * The actuator extends from its estimated position to actuator_config_t::time_stroke, and retracts back home
+ *
  * This function is a no-op if the actuator is currently in an extend-retract cycle
  *
  * @param a Actuator to trigger
  */
 void actuator_trigger(struct actuator_t* const a);
+
+/**
+ * Trigger an extend-retract cycle that starts no earlier than not_before
+ *
+ * The rest before the extend begins at not_before (or now, if that has passed), actuator_in_cycle() is true from now on.
+ * @ref ACTUATOR_BACKEND_PIO cycles always start right away, so those are only triggered once not_before has passed.
+ *
+ * @param a Actuator to trigger
+ * @param not_before Time (in microseconds since boot)
+ *
+ * @returns True if the cycle was triggered, False if the actuator is in a cycle or can't start that late
+ */
+bool actuator_trigger_after(struct actuator_t* const a, const uint64_t not_before);
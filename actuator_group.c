@@ -0,0 +1,47 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Actuator groups: the "ON" and "OFF" actuators of a zone, moved as one (Implementation)
+ */
+
+#include "actuator_group.h"
+
+bool actuator_group_trigger(const struct actuator_group_t* const g, const bool on)
+{
+    struct actuator_t* const a = on ? g->on : g->off;
+    const struct actuator_t* const other = on ? g->off : g->on;
+    if (a == other)
+        return actuator_trigger_after(a, 0);
+
+    /* The cycle begins with a rest, so starting as the other actuator stops extending (or retracting) is enough */
+    uint64_t not_before = 0;
+    if (actuator_in_cycle(other))
+        not_before = g->exclusive ? other->timestamp_end_retract : other->timestamp_end_extend;
+    return actuator_trigger_after(a, not_before);
+}
@@ -0,0 +1,65 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Actuator groups: the "ON" and "OFF" actuators of a zone, moved as one
+ *
+ * A group decides when the actuator for a new state may start, given what the other actuator is doing:
+ * - The two actuators never extend (press their switches) at the same time
+ * - With actuator_group_t::exclusive, they are never energized at the same time at all
+ *
+ * Otherwise the actuators move in parallel: an actuator triggered while the other one is extending starts extending as
+ * the other one starts retracting, instead of waiting for the whole cycle of the other one to end.
+ *
+ * Extend and retract of a single actuator are exclusive by construction, its outputs are driven from a single phase
+ * (see actuator_t::phase). host/replay.c checks all of these rules after every GPIO write.
+ */
+#pragma once
+
+#include "actuator.h"
+
+#include <stdbool.h> /* bool */
+
+struct actuator_group_t
+{
+    struct actuator_t* on; ///< Actuator that switches to "ON"
+    struct actuator_t* off; ///< Actuator that switches to "OFF"
+    bool exclusive; ///< Never energize both actuators at the same time (eg. for a supply that can only drive one)
+};
+
+/**
+ * Start a cycle of the actuator for a state, as early as the rules of the group allow
+ *
+ * The cycle may be scheduled to start later (see actuator_trigger_after()), the group is busy from now on either way
+ *
+ * @param on State to switch to
+ *
+ * @returns True if a cycle was started or scheduled, False if the actuator for the state is busy (or is an
+ *          @ref ACTUATOR_BACKEND_PIO actuator that can't be scheduled ahead)
+ */
+bool actuator_group_trigger(const struct actuator_group_t* const g, const bool on);
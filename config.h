@@ -53,12 +53,66 @@
 /** Time (in microseconds) to rest between switching directions */
 #define ACTUATOR_REST_TIME (500ull * 1000ull)
 
+/**
+ * Time (in microseconds) of extension needed to operate a switch
+ *
+ * Lower this to the distance the switch actually needs for shorter cycles (Both the extend and the retract shrink)
+ *
+ * NOTE: This defaults to full travel, as the distance depends on how the actuators are mounted against the switches and
+ *       a stroke that falls short leaves the switch untouched. Measure it on the installation (the shortest extend that
+ *       reliably operates the switch, plus some allowance) before lowering it, and check the value with
+ *       host/build/actuator-position-sim --stroke US. With full travel every cycle ends at home, so the retained
+ *       position is 0 and only the retract on boot is skipped (see @ref ACTUATOR_RETAIN_POSITION).
+ */
+#define ACTUATOR_STROKE_TIME ACTUATOR_TRAVEL_TIME
+
+/**
+ * Time (in microseconds) to retract past the estimated actuator position
+ *
+ * Must cover the speed variation of the actuators: with every movement within +/- t of nominal speed, at least
+ * ACTUATOR_STROKE_TIME * 2t / (1 - t), eg. 0.83 s for a 10 s stroke at 4% (See host/position_sim.c)
+ */
+#define ACTUATOR_POSITION_MARGIN (1000ull * 1000ull)
+
+/**
+ * Keep estimated actuator positions across watchdog reboots (eg. AUTOMATIC_REBOOT_INTERVAL)
+ *
+ * Actuators that are known to be retracted then skip the retract on boot, after a power cycle every actuator retracts
+ */
+#define ACTUATOR_RETAIN_POSITION 1
+
+/**
+ * Never energize the "ON" and "OFF" actuators of a zone at the same time (eg. for a supply that can only drive one)
+ *
+ * Set to 0 to let an actuator start its cycle while the other one retracts (see actuator_group.h). The two then never
+ * extend together, but one may push its switch while the other is still pulling back from the opposite position, so
+ * only opt in where the switch takes that. Also staggers the retracts on boot.
+ */
+#define ACTUATOR_GROUP_EXCLUSIVE_ENERGIZE 1
+
 /** Logic level that must be put to "extend" gpio pin for actuator retraction to occur */
 #define ACTUATOR_ACTIVE_LOGIC_LEVEL_EXTEND 1
 
 /** Logic level that must be put to "retract" gpio pin for actuator retraction to occur */
 #define ACTUATOR_ACTIVE_LOGIC_LEVEL_RETRACT 1
 
+/**
+ * Switch actuator outputs from a hardware timer alarm instead of waiting for the core 1 loop to reach actuator_poll()
+ *
+ * The loop can spend milliseconds in LCD writes and printf(), with this the relays switch within microseconds of the
+ * computed phase times. The measured lateness is shown in the status output either way.
+ */
+#define ACTUATOR_ALARM_EDGES 1
+
+/**
+ * How actuator outputs are driven (An actuator_backend_t value)
+ *
+ * ACTUATOR_BACKEND_CPU: GPIO writes from core 1 (See ACTUATOR_ALARM_EDGES)
+ * ACTUATOR_BACKEND_PIO: A PIO state machine per actuator plays the whole cycle, core 1 only triggers it and reads back
+ *                       completion. Requires the retract pin of every actuator to be the pin after its extend pin.
+ */
+#define ACTUATOR_BACKEND ACTUATOR_BACKEND_CPU
+
 /******************************************************
  *                  SCHEDULE CONFIG                   *
  ******************************************************/
@@ -74,10 +128,50 @@
 #define SCHEDULE_SELECT_PIN 14
 
 /**
- * Length of time (in seconds) to repeatedly cycle the actuator when the schedule calls for an update
+ * Actuators, as ACTUATOR(gpio extend, gpio retract)
+ *
+ * Each actuator takes two relay channels, zones refer to actuators by their index in this table
+ */
+#define ACTUATOR_TABLE(ACTUATOR)                                               \
+    ACTUATOR(ACTUATOR_GPIO_ACT_ON_EXTEND, ACTUATOR_GPIO_ACT_ON_RETRACT) /* 0 */ \
+    ACTUATOR(ACTUATOR_GPIO_ACT_OFF_EXTEND, ACTUATOR_GPIO_ACT_OFF_RETRACT) /* 1 */
+
+/**
+ * Zones, as ZONE(level, select gpio, select active level, "ON" actuator index, "OFF" actuator index, trigger policy,
+ * cycles)
+ *
+ * The trigger policy (a zone_trigger_policy_t) decides how often a region of the schedule cycles the actuator:
+ * - ZONE_TRIGGER_CYCLES: The given number of cycles per region
+ * - ZONE_TRIGGER_UNTIL_REGION_END: Back to back cycles until @ref SCHEDULE_TRIGGER_REGION_LENGTH has passed
+ * - ZONE_TRIGGER_ONCE_HOLD_OFF: One cycle, and none for following regions of the same state until the state changes
+ *
+ * The first cycle of a region always fires at the same time, cycles is ignored by all but ZONE_TRIGGER_CYCLES
+ *
+ * A zone runs the built-in schedule_level_<level> schedules, or the schedule at its position in this table from the
+ * schedule partition
+ *
+ * A zone is enabled if its select gpio (pulled high) reads the select active level at boot. Zones may share select
+ * gpios and actuators, but zones that share actuators must not be enabled at the same time
+ */
+#define ZONE_TABLE(ZONE)                                                \
+    ZONE(1, SCHEDULE_SELECT_PIN, 1, 0, 1, ZONE_TRIGGER_CYCLES, 1) /* L1 */ \
+    ZONE(2, SCHEDULE_SELECT_PIN, 0, 0, 1, ZONE_TRIGGER_CYCLES, 1) /* L2 */
+
+/**
+ * Length of time (in seconds) of a region, in which the actuator is cycled when the schedule calls for an update
+ *
+ * See the trigger policy of @ref ZONE_TABLE for how often
  */
 #define SCHEDULE_TRIGGER_REGION_LENGTH (60ull)
 
+/**
+ * Length of time (in seconds) after the start of a region that its actuation stays queued (see zone_request())
+ *
+ * An actuation that can't start within @ref SCHEDULE_TRIGGER_REGION_LENGTH because the actuators are still busy runs
+ * once they are free, as long as this hasn't passed. Must be at least @ref SCHEDULE_TRIGGER_REGION_LENGTH.
+ */
+#define SCHEDULE_COMMAND_DEADLINE (5ull * 60ull)
+
 /**
  * When reloading schedule, trigger an "ON" actuation if the last status was "ON"
  */
@@ -88,6 +182,120 @@
  */
 #define SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_OFF_REGION 0
 
+/** Schedule source: Expanded tables (schedule_level_*.h) */
+#define SCHEDULE_SOURCE_TABLES 0
+
+/** Schedule source: Recurrence rules (schedule_level_*_rules.h), these take the least flash and do not have an end date */
+#define SCHEDULE_SOURCE_RULES 1
+
+/** Schedule source: Delta/varint packed tables (schedule_level_*_packed.h), these take about half the flash of the table entries */
+#define SCHEDULE_SOURCE_PACKED 2
+
+/**
+ * Where the schedules are evaluated from (One of the SCHEDULE_SOURCE_* values)
+ *
+ * Set to @ref SCHEDULE_SOURCE_RULES or @ref SCHEDULE_SOURCE_PACKED to opt in to the smaller representations
+ */
+#define SCHEDULE_SOURCE SCHEDULE_SOURCE_TABLES
+
+/**
+ * Number of times core 1 decodes each packed schedule at boot to measure decode throughput
+ *
+ * Set to 0 to disable the benchmark
+ */
+#define SCHEDULE_PACKED_DECODE_BENCHMARK 0
+
+/**
+ * Use the schedules in the schedule flash partition (see schedule_partition.h) when it holds a valid image
+ *
+ * The schedules selected by @ref SCHEDULE_SOURCE are used if the partition is disabled, empty or invalid
+ */
+#define SCHEDULE_PARTITION_ENABLE 1
+
+/** Size (in bytes) of the schedule flash partition (Must be a multiple of the flash sector size) */
+#define SCHEDULE_PARTITION_SIZE (64u * 1024u)
+
+/**
+ * Offset (in bytes from the start of flash) of the schedule flash partition (Must be a multiple of the flash sector size)
+ *
+ * Must match the --offset argument of make_schedule_partition.py
+ */
+#define SCHEDULE_PARTITION_OFFSET (PICO_FLASH_SIZE_BYTES - SCHEDULE_PARTITION_SIZE)
+
+/**
+ * Number of slots the schedule flash partition is split into
+ *
+ * Uploads are written to a slot that is not in use, so there must be at least 2 slots for @ref SCHEDULE_UPLOAD_ENABLE
+ */
+#define SCHEDULE_PARTITION_NUM_SLOTS 2
+
+/** Size (in bytes) of each slot of the schedule flash partition (Must be a multiple of the flash sector size) */
+#define SCHEDULE_PARTITION_SLOT_SIZE (SCHEDULE_PARTITION_SIZE / SCHEDULE_PARTITION_NUM_SLOTS)
+
+/**
+ * Accept new schedule partition images over TCP (see schedule_upload.h and upload_schedule.py)
+ *
+ * Set by the SCHEDULE_UPLOAD option in CMakeLists.txt, which also leaves schedule_upload.c out of the build without it
+ *
+ * WARNING: Uploads are not authenticated, anyone who can reach @ref SCHEDULE_UPLOAD_PORT can replace the schedules that
+ *          drive the switches. Only enable this on a trusted network.
+ */
+#ifndef SCHEDULE_UPLOAD_ENABLE
+#define SCHEDULE_UPLOAD_ENABLE 0
+#endif
+
+/** TCP port to accept schedule uploads on */
+#define SCHEDULE_UPLOAD_PORT 4242
+
+/** Time (in microseconds) without progress after which an upload is aborted */
+#define SCHEDULE_UPLOAD_TIMEOUT (30ull * 1000ull * 1000ull)
+
+/******************************************************
+ *                 FLASH GUARD CONFIG                 *
+ ******************************************************/
+
+/**
+ * Time (in microseconds) before a core 1 actuator or schedule event during which no flash erase/program may begin
+ *
+ * Core 1 is paused while flash is erased or programmed, this keeps those pauses away from actuator timing (Applies to
+ * both @ref SCHEDULE_UPLOAD_ENABLE and @ref WEAR_LOG_ENABLE)
+ */
+#define FLASH_GUARD_TIME (500ull * 1000ull)
+
+/******************************************************
+ *               ACTUATOR WEAR LOG CONFIG             *
+ ******************************************************/
+
+/** Keep persistent per-actuator usage counters in a flash log (see wear_log.h) */
+#define WEAR_LOG_ENABLE 1
+
+/** Size (in bytes) of the wear log (Must be a multiple of the flash sector size, and at least 2 sectors) */
+#define WEAR_LOG_SIZE (16u * 1024u)
+
+/** Offset (in bytes from the start of flash) of the wear log, right below the schedule partition */
+#define WEAR_LOG_OFFSET (SCHEDULE_PARTITION_OFFSET - WEAR_LOG_SIZE)
+
+/**
+ * Minimum time (in microseconds) between wear log records
+ *
+ * Counters survive watchdog reboots without a record, this only bounds what a power loss costs. Each record takes a
+ * page, so the default erases each of the 4 sectors once every 64 hours.
+ */
+#define WEAR_LOG_COMMIT_INTERVAL (60ull * 60ull * 1000ull * 1000ull)
+
+/******************************************************
+ *              TRANSITION JOURNAL CONFIG             *
+ ******************************************************/
+
+/** Record relay changes, actuator triggers, and schedule regions in a ring buffer in RAM (see journal.h) */
+#define JOURNAL_ENABLE 1
+
+/** Number of entries in the journal (Must be a power of 2), each takes 32 bytes */
+#define JOURNAL_SIZE 512
+
+/** Character that dumps the journal when received on stdio */
+#define JOURNAL_DUMP_KEY 'j'
+
 /******************************************************
  *                  TIMEZONE CONFIG                   *
  ******************************************************/
@@ -108,6 +316,14 @@
 /** I2C address of status LCD */
 #define STATUS_LCD_I2C_ADDRESS 0x27u
 
+/**
+ * I2C clock rate (in Hz) of the status LCD
+ *
+ * The LCD timing is derived from this. The PCF8574 is only specified up to 100 kHz, 400 kHz works with many backpacks
+ * and cuts the time of a full refresh to a quarter, but is opt-in.
+ */
+#define STATUS_LCD_I2C_BAUDRATE (100u * 1000u)
+
 /** I2C data pin to use for status LCD */
 #define STATUS_LCD_I2C_SDA_PIN PICO_DEFAULT_I2C_SDA_PIN
 
@@ -119,6 +335,31 @@
  */
 #define STATUS_LCD_INTERVALS_PER_PAGE 8
 
+/**
+ * Watch the status LCD, and power cycle it with @ref I2C_POWER_INTERRUPT_GPIO when it fails (see lcd_poll())
+ *
+ * Aborted i2c transfers (eg. no ack from the PCF8574) count as failures, as does a display that does not read back what
+ * was written to it. Reading back needs the R/W pin of the display on P1 of the PCF8574, as on the common backpacks.
+ */
+#define STATUS_LCD_WATCHDOG_ENABLE 1
+
+/** Interval (in microseconds) between read backs of one character and the address counter of the status LCD */
+#define STATUS_LCD_VERIFY_INTERVAL (5ull * 1000ull * 1000ull)
+
+/** Time (in microseconds) a read back of the status LCD may take before it counts as failed */
+#define STATUS_LCD_VERIFY_TIMEOUT (100ull * 1000ull)
+
+/**
+ * Time (in microseconds) to wait before power cycling the status LCD again, if the last power cycle did not help
+ *
+ * Doubles with each further power cycle that does not help, up to @ref STATUS_LCD_RETRY_TIME_MAX, so that a missing
+ * display does not wear out the relay.
+ */
+#define STATUS_LCD_RETRY_TIME (60ull * 1000ull * 1000ull)
+
+/** Longest time (in microseconds) to wait between power cycles of the status LCD */
+#define STATUS_LCD_RETRY_TIME_MAX (60ull * 60ull * 1000ull * 1000ull)
+
 /******************************************************
  *             I2C POWER INTERRUPT CONFIG             *
  ******************************************************/
@@ -153,6 +394,8 @@
 
 /**
  * WS2812 status led heartbeat sine wave period (in milliseconds)
+ *
+ * NOTE: With @ref CORE1_TICKLESS the heartbeat instead alternates between bright and dim every @ref STATUS_PRINT_INTERVAL
  */
 #define WS2812_STATUS_HEARTBEAT_PERIOD 2048
 
@@ -184,3 +427,15 @@
  * Number of samples to use for average loop times
  */
 #define LOOP_AVERAGE_SAMPLE_COUNT 256
+
+/**
+ * Sleep core 1 between events instead of looping continuously
+ *
+ * Core 1 works out when its outputs can next change (schedule boundary, actuator phase change, status/LCD refresh),
+ * arms a hardware timer alarm for it, and waits for it with WFE
+ *
+ * At rest this is one wakeup every @ref STATUS_PRINT_INTERVAL (3600 wakeups/h with the default of 1 second), plus a
+ * few per actuation and while the LCD watchdog recovers the display. The WS2812 status led is only updated on these
+ * wakeups.
+ */
+#define CORE1_TICKLESS 1
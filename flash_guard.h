@@ -0,0 +1,51 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Keep flash erase/program operations on core 0 away from core 1 events
+ *
+ * Core 1 is paused while flash is erased or programmed (see flash_safe_execute()). Core 1 publishes when it next has
+ * to act on time, and core 0 only begins a flash operation while that is more than @ref FLASH_GUARD_TIME away.
+ *
+ * Used by the schedule upload (see schedule_upload.h) and the wear log (see wear_log.h), either of which can be
+ * disabled without the other.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Time (in milliseconds since boot, truncated to 32 bits) of the next core 1 actuator or schedule event
+ *
+ * Published by core 1 every loop
+ */
+extern volatile uint32_t flash_guard_core1_next_event_ms;
+
+/** Check that no core 1 event is due within @ref FLASH_GUARD_TIME */
+bool flash_guard_allowed(void);
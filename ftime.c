@@ -32,6 +32,7 @@
 #include "ftime.h"
 
 #include "pico/stdlib.h"
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -48,7 +49,8 @@ char* fdelta_us(int64_t us, char* const buffer, size_t buf_size)
     uint64_t h = m / 60ull;
     uint64_t d = h / 24ull;
 
-    snprintf(buffer, buf_size, "%c%02llu:%02llu:%02llu:%02llu.%06llu", negative ? '-' : '+', d, h % 24ull, m % 60ull, s % 60ull, us % 1000000ull);
+    snprintf(buffer, buf_size, "%c%02" PRIu64 ":%02" PRIu64 ":%02" PRIu64 ":%02" PRIu64 ".%06" PRIu64, negative ? '-' : '+', d, h % 24, m % 60, s % 60,
+        (uint64_t)us % 1000000);
     return buffer;
 }
 
@@ -61,7 +63,7 @@ char* fdelta(int64_t s, char* const buffer, size_t buf_size)
     uint64_t h = m / 60ull;
     uint64_t d = h / 24ull;
 
-    snprintf(buffer, buf_size, "%c%02llu:%02llu:%02llu:%02llu", negative ? '-' : '+', d, h % 24ull, m % 60ull, s % 60ull);
+    snprintf(buffer, buf_size, "%c%02" PRIu64 ":%02" PRIu64 ":%02" PRIu64 ":%02" PRIu64, negative ? '-' : '+', d, h % 24, m % 60, (uint64_t)s % 60);
     return buffer;
 }
 
@@ -79,7 +81,7 @@ char* ftime_us(const int64_t us, char* const buffer, size_t buf_size)
     gmtime_r_64bit_us(us, &tm);
     get_tz_corrected_tm_64_bit(&tm, &tm, TIMEZONE_OFFSET_ST, TIMEZONE_OFFSET_DT);
 
-    snprintf(buffer, buf_size, "%04lld-%02d-%02d %02d:%02d:%02d.%06d", //
+    snprintf(buffer, buf_size, "%04" PRId64 "-%02d-%02d %02d:%02d:%02d.%06d", //
         tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, tm.tm_usec);
     return buffer;
 }
@@ -90,7 +92,7 @@ char* ftime(const int64_t s, char* const buffer, size_t buf_size)
     gmtime_r_64bit(s, &tm);
     get_tz_corrected_tm_64_bit(&tm, &tm, TIMEZONE_OFFSET_ST, TIMEZONE_OFFSET_DT);
 
-    snprintf(buffer, buf_size, "%04lld-%02d-%02d %02d:%02d:%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+    snprintf(buffer, buf_size, "%04" PRId64 "-%02d-%02d %02d:%02d:%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
     return buffer;
 }
 
@@ -100,6 +102,6 @@ char* ftime_compact(const int64_t s, char* const buffer, size_t buf_size)
     gmtime_r_64bit(s, &tm);
     get_tz_corrected_tm_64_bit(&tm, &tm, TIMEZONE_OFFSET_ST, TIMEZONE_OFFSET_DT);
 
-    snprintf(buffer, buf_size, "%04lld%02d%02d %02d%02d%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+    snprintf(buffer, buf_size, "%04" PRId64 "%02d%02d %02d%02d%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
     return buffer;
 }
@@ -21,6 +21,7 @@
 # FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
 # DEALINGS IN THE SOFTWARE.
 import datetime
+import math
 import zoneinfo
 import struct
 
@@ -186,17 +187,159 @@ def generate_schedule(time_on: list[list[datetime.timedelta]],
 
     return sorted(out, key=lambda x: x[0])
 
+def successor_indices(sched: list[tuple[int, bool]]) -> tuple[list[int], list[int], list[int]]:
+    """
+    Returns the (next_on, next_off, region_end) index tables for a sorted schedule
+
+    next_on[i]/next_off[i] are the index of the first ON/OFF entry at or after i
+    region_end[i] is the index of the first entry after i whose state differs from entry i
+
+    Each table has len(sched) + 1 elements, len(sched) is used as the "no such entry" marker
+    """
+    n = len(sched)
+    next_on = [n] * (n + 1)
+    next_off = [n] * (n + 1)
+    region_end = [n] * (n + 1)
+    for i in range(n - 1, -1, -1):
+        next_on[i] = i if sched[i][1] else next_on[i + 1]
+        next_off[i] = next_off[i + 1] if sched[i][1] else i
+        region_end[i] = next_off[i + 1] if sched[i][1] else next_on[i + 1]
+    return next_on, next_off, region_end
+
+def write_index_table(fd, name: str, table: list[int]) -> None:
+    fd.write(f"static const uint32_t {name}[] =" " {\n")
+    for i in range(0, len(table), 16):
+        fd.write("    " + " ".join("%4d," % x for x in table[i:i + 16]) + "\n")
+    fd.write("};\n")
+
 def write_schedule_header(name: str, sched: list[tuple[int, bool]]) -> None:
+    next_on, next_off, region_end = successor_indices(sched)
     with open(f"{name}.h", 'w') as fd:
         epoch = sched[0][0]
         fd.write("/* clang-format off */\n")
-        fd.write(f"static const schedule_t {name} =" " { " f"{sched[0][0]}ull, {len(sched)},\n")
-        fd.write("    {\n")
+        fd.write(f"static const schedule_entry_t {name}_entries[] =" " {\n")
         for i in sched:
-            fd.write("        {% 9d, %d, %d }, // %s\n" % (i[0] - epoch, i[1], i[2], i[3].strftime("%Y-%m-%d %H:%M:%S %:z")))
-        fd.write("    } };\n")
+            fd.write("    {% 9d, %d, %d }, // %s\n" % (i[0] - epoch, i[1], i[2], i[3].strftime("%Y-%m-%d %H:%M:%S %:z")))
+        fd.write("};\n")
+        write_index_table(fd, f"{name}_next_on", next_on)
+        write_index_table(fd, f"{name}_next_off", next_off)
+        write_index_table(fd, f"{name}_region_end", region_end)
+        fd.write(f"static const schedule_t {name} =" " { " f"{epoch}ull, {len(sched)}, "
+                 f"{name}_entries, {name}_next_on, {name}_next_off, {name}_region_end" " };\n")
+        fd.write("/* clang-format on */\n")
+
+def varint(value: int) -> bytes:
+    """ Unsigned LEB128 """
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+def pack_schedule(sched: list[tuple[int, bool]]) -> tuple[int, int, bytes]:
+    """
+    Returns the (epoch, resolution, data) of the packed representation of a sorted schedule (see schedule_packed.h)
+
+    resolution is the largest number of seconds that divides every timestamp delta
+    """
+    epoch = sched[0][0]
+    deltas = [b[0] - a[0] for a, b in zip([sched[0]] + sched[:-1], sched)]
+    resolution = 0
+    for i in deltas:
+        resolution = math.gcd(resolution, i)
+    resolution = max(resolution, 1)
+    data = b"".join(varint(((d // resolution) << 2) | (i[1] << 1) | i[2]) for d, i in zip(deltas, sched))
+    return epoch, resolution, data
+
+def write_packed_header(name: str, sched: list[tuple[int, bool]]) -> None:
+    epoch, resolution, data = pack_schedule(sched)
+    with open(f"{name}.h", 'w') as fd:
+        fd.write("/* clang-format off */\n")
+        fd.write(f"static const uint8_t {name}_data[] =" " {\n")
+        for i in range(0, len(data), 16):
+            fd.write("    " + " ".join("0x%02x," % x for x in data[i:i + 16]) + "\n")
+        fd.write("};\n")
+        fd.write(f"static const schedule_packed_t {name} =" " { " f"{epoch}ull, {resolution}, {len(sched)}, {len(data)}, {name}_data" " };\n")
+        fd.write("/* clang-format on */\n")
+
+def print_size_report(name: str, sched: list[tuple[int, bool]], time_on, time_off_soft, time_off) -> None:
+    """ Print the flash usage of every schedule representation (excluding the fixed size structs) """
+    n = len(sched)
+    table_entries = 4 * n
+    table_index = 3 * 4 * (n + 1)
+    packed = len(pack_schedule(sched)[2])
+    rule_events = 4 * sum(len(x[d]) for x in (time_on, time_off_soft, time_off, time_on_exercise, time_off_exercise) for d in range(7))
+    rule_ranges = 8 * len(exception_ranges())
+    print(f"{name}: {n} entries")
+    print(f"    table:  {table_entries + table_index:6d} bytes ({table_entries} entries + {table_index} index tables)")
+    print(f"    packed: {packed:6d} bytes ({packed / n:.2f} bytes/entry, {100.0 * packed / table_entries:.1f}% of the table entries)")
+    print(f"    rules:  {rule_events + rule_ranges:6d} bytes ({rule_events} events + {rule_ranges} exception ranges)")
+
+def day_number(day: datetime.datetime) -> int:
+    """ Local days since 1970-01-01 """
+    return (day.date() - datetime.date(1970, 1, 1)).days
+
+def exception_ranges() -> list[tuple[int, int]]:
+    """ Merge schedule_exceptions into sorted, non-overlapping and inclusive (first, last) day ranges """
+    ranges = []
+    for i in sorted(set(day_number(x) for x in schedule_exceptions)):
+        if ranges and ranges[-1][1] + 1 == i:
+            ranges[-1] = (ranges[-1][0], i)
+        else:
+            ranges.append((i, i))
+    return ranges
+
+day_names = ["Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"]
+
+def write_week(fd, name: str, events: list[list[tuple[datetime.timedelta, bool, bool]]]) -> str:
+    """ Writes the events array of a weekly template and returns the initializer of the schedule_week_t """
+    day_start = [0]
+    fd.write(f"static const schedule_entry_t {name}[] =" " {\n")
+    for day_of_week, day in enumerate(events):
+        for (offset, on, allow_resume) in sorted(day, key=lambda x: x[0]):
+            seconds = int(offset.total_seconds())
+            fd.write("    {% 9d, %d, %d }, // %s %02d:%02d\n" % (seconds, on, allow_resume, day_names[day_of_week], seconds // 3600, seconds // 60 % 60))
+        day_start.append(day_start[-1] + len(day))
+    if day_start[-1] == 0:
+        fd.write("    { 0, 0, 0 }, // Placeholder, no events\n")
+    fd.write("};\n")
+    return "{ " + name + ", { " + ", ".join(str(x) for x in day_start) + " } }"
+
+def write_rules_header(name: str,
+                       time_on: list[list[datetime.timedelta]],
+                       time_off_soft: list[list[datetime.timedelta]],
+                       time_off: list[list[datetime.timedelta]]
+                       ) -> None:
+    regular = [[(i, 1, 1) for i in time_on[d]] + [(i, 0, 0) for i in time_off_soft[d]] + [(i, 0, 1) for i in time_off[d]] for d in range(7)]
+    exception = [[(i, 1, 1) for i in time_on_exercise[d]] + [(i, 0, 1) for i in time_off_exercise[d]] for d in range(7)]
+    ranges = exception_ranges()
+    epoch = datetime.date(1970, 1, 1)
+    with open(f"{name}.h", 'w') as fd:
+        fd.write("/* clang-format off */\n")
+        regular_init = write_week(fd, f"{name}_regular", regular)
+        exception_init = write_week(fd, f"{name}_exception", exception)
+        fd.write(f"static const schedule_day_range_t {name}_exceptions[] =" " {\n")
+        for (first, last) in ranges:
+            fd.write("    { %d, %d }, // %s - %s\n" % (first, last, epoch + datetime.timedelta(days=first), epoch + datetime.timedelta(days=last)))
+        fd.write("};\n")
+        fd.write(f"static const schedule_rules_t {name} =" " {\n")
+        fd.write(f"    {regular_init},\n")
+        fd.write(f"    {exception_init},\n")
+        fd.write(f"    {len(ranges)}, {name}_exceptions" " };\n")
         fd.write("/* clang-format on */\n")
 
 if __name__ == '__main__':
     write_schedule_header("schedule_level_1", generate_schedule(time_on_level_1, time_off_soft_level_1, time_off_level_1))
     write_schedule_header("schedule_level_2", generate_schedule(time_on_level_2, time_off_soft_level_2, time_off_level_2))
+    write_rules_header("schedule_level_1_rules", time_on_level_1, time_off_soft_level_1, time_off_level_1)
+    write_rules_header("schedule_level_2_rules", time_on_level_2, time_off_soft_level_2, time_off_level_2)
+
+    for level, times in (("level_1", (time_on_level_1, time_off_soft_level_1, time_off_level_1)),
+                         ("level_2", (time_on_level_2, time_off_soft_level_2, time_off_level_2))):
+        sched = generate_schedule(*times)
+        write_packed_header(f"schedule_{level}_packed", sched)
+        print_size_report(f"schedule_{level}", sched, *times)
@@ -0,0 +1,80 @@
+// ---------------------------------------------------------------- //
+// This file is autogenerated by pioasm version 2.2.0; do not edit! //
+// ---------------------------------------------------------------- //
+
+#pragma once
+
+#if !PICO_NO_HARDWARE
+#include "hardware/pio.h"
+#endif
+
+// -------- //
+// actuator //
+// -------- //
+
+#define actuator_wrap_target 5
+#define actuator_wrap 18
+#define actuator_pio_version 0
+
+#define actuator_PHASE_OVERHEAD 3
+
+static const uint16_t actuator_program_instructions[] = {
+    0x80a0, //  0: pull   block
+    0xa0c7, //  1: mov    isr, osr
+    0x80a0, //  2: pull   block
+    0xa047, //  3: mov    y, osr
+    0x000e, //  4: jmp    14
+            //     .wrap_target
+    0x80a0, //  5: pull   block
+    0xa026, //  6: mov    x, isr
+    0x0047, //  7: jmp    x--, 7
+    0xe001, //  8: set    pins, 1
+    0xa022, //  9: mov    x, y
+    0x004a, // 10: jmp    x--, 10
+    0xe000, // 11: set    pins, 0
+    0xa026, // 12: mov    x, isr
+    0x004d, // 13: jmp    x--, 13
+    0xe002, // 14: set    pins, 2
+    0xa022, // 15: mov    x, y
+    0x0050, // 16: jmp    x--, 16
+    0xe000, // 17: set    pins, 0
+    0xc010, // 18: irq    nowait 0 rel
+            //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program actuator_program = {
+    .instructions = actuator_program_instructions,
+    .length = 19,
+    .origin = -1,
+    .pio_version = actuator_pio_version,
+#if PICO_PIO_VERSION > 0
+    .used_gpio_ranges = 0x0
+#endif
+};
+
+static inline pio_sm_config actuator_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + actuator_wrap_target, offset + actuator_wrap);
+    return c;
+}
+
+#include "hardware/clocks.h"
+static inline void actuator_program_init(PIO pio, uint sm, uint offset, uint pin_extend, bool invert_extend, bool invert_retract, uint32_t rest_us, uint32_t travel_us) {
+    pio_gpio_init(pio, pin_extend);
+    pio_gpio_init(pio, pin_extend + 1);
+    gpio_set_outover(pin_extend, invert_extend ? GPIO_OVERRIDE_INVERT : GPIO_OVERRIDE_NORMAL);
+    gpio_set_outover(pin_extend + 1, invert_retract ? GPIO_OVERRIDE_INVERT : GPIO_OVERRIDE_NORMAL);
+    pio_sm_set_pins_with_mask(pio, sm, 0, 3u << pin_extend);
+    pio_sm_set_consecutive_pindirs(pio, sm, pin_extend, 2, true);
+    pio_sm_config c = actuator_program_get_default_config(offset);
+    sm_config_set_set_pins(&c, pin_extend, 2);
+    sm_config_set_clkdiv(&c, (float)clock_get_hz(clk_sys) / 1000000.0f);
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_put(pio, sm, rest_us - actuator_PHASE_OVERHEAD);
+    pio_sm_put(pio, sm, travel_us - actuator_PHASE_OVERHEAD);
+    pio_interrupt_clear(pio, sm);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif
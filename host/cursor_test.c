@@ -0,0 +1,233 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Check every schedule evaluator against the reference scan
+ *
+ * Walks every entry boundary (entry time and end of its trigger region, each -1, +0, +1 seconds) of the built-in
+ * schedules, and checks schedule_get_state() and the table, packed, and rule cursors against schedule_get_state_scan().
+ * The walk is then repeated with random jumps backwards, which force the cursors to re-seek.
+ *
+ * Rule schedules have no end, so they are only compared within the span of the table that they were generated with,
+ * and only where the table has a next "ON"/"OFF" entry to compare to.
+ *
+ * Exits with a non-zero status if any check fails.
+ */
+#include "schedule.h"
+#include "schedule_packed.h"
+#include "schedule_rules.h"
+
+#include "config.h"
+
+#include "schedule_level_1.h"
+#include "schedule_level_1_packed.h"
+#include "schedule_level_1_rules.h"
+#include "schedule_level_2.h"
+#include "schedule_level_2_packed.h"
+#include "schedule_level_2_rules.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Number of random backwards jumps per schedule and source */
+#define NUM_BACKWARD_JUMPS 4096
+
+/** Maximum number of mismatches printed per schedule and source */
+#define MAX_PRINTED_MISMATCHES 8
+
+static int failures = 0;
+
+enum source_t
+{
+    SOURCE_TABLE,
+    SOURCE_PACKED,
+    SOURCE_RULES,
+    SOURCE_COUNT,
+};
+
+static const char* const source_names[SOURCE_COUNT] = {
+    "table",
+    "packed",
+    "rules",
+};
+
+struct test_schedule_t
+{
+    const char* name;
+    const schedule_t* table;
+    const schedule_packed_t* packed;
+    const schedule_rules_t* rules;
+};
+
+static const struct test_schedule_t test_schedules[] = {
+    { "level_1", &schedule_level_1, &schedule_level_1_packed, &schedule_level_1_rules },
+    { "level_2", &schedule_level_2, &schedule_level_2_packed, &schedule_level_2_rules },
+};
+
+/** Offsets (in seconds) from every entry that are checked */
+static const int64_t boundary_offsets[] = {
+    -1, 0, 1, SCHEDULE_TRIGGER_REGION_LENGTH - 1, SCHEDULE_TRIGGER_REGION_LENGTH, SCHEDULE_TRIGGER_REGION_LENGTH + 1,
+};
+
+#define NUM_BOUNDARY_OFFSETS (sizeof(boundary_offsets) / sizeof(*boundary_offsets))
+
+/** xorshift64, same as schedule_bench.c */
+static uint64_t rand_state = 0x9E3779B97F4A7C15ull;
+static uint64_t rand64(void)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 7;
+    rand_state ^= rand_state << 17;
+    return rand_state;
+}
+
+/** Time (in seconds since 1970-01-01) of the i-th boundary of a table */
+static int64_t boundary_time(const schedule_t* const table, const uint32_t i)
+{
+    return (int64_t)(table->epoch + table->entries[i / NUM_BOUNDARY_OFFSETS].timestamp) + boundary_offsets[i % NUM_BOUNDARY_OFFSETS];
+}
+
+static bool state_equal(const schedule_current_state_t* const a, const schedule_current_state_t* const b)
+{
+    return a->on == b->on && a->allow_resume == b->allow_resume && a->in_region == b->in_region && a->timestamp_region_start == b->timestamp_region_start
+        && a->timestamp_region_next_on == b->timestamp_region_next_on && a->timestamp_region_next_off == b->timestamp_region_next_off;
+}
+
+static void state_print(const char* const label, const schedule_current_state_t* const s)
+{
+    printf("    %-9s on: %d, allow_resume: %d, in_region: %d, start: %" PRIu64 ", next_on: %" PRIu64 ", next_off: %" PRIu64 "\n", label, s->on, s->allow_resume, s->in_region,
+        s->timestamp_region_start, s->timestamp_region_next_on, s->timestamp_region_next_off);
+}
+
+struct check_ctx_t
+{
+    const struct test_schedule_t* s;
+    enum source_t source;
+    schedule_cursor_t cursor;
+    uint32_t checks;
+    uint32_t mismatches;
+};
+
+static void check_init(struct check_ctx_t* const ctx, const struct test_schedule_t* const s, const enum source_t source)
+{
+    ctx->s = s;
+    ctx->source = source;
+    if (source == SOURCE_TABLE)
+        schedule_cursor_init(&ctx->cursor, s->table);
+    else if (source == SOURCE_PACKED)
+        schedule_cursor_init_packed(&ctx->cursor, s->packed);
+    else
+        schedule_cursor_init_rules(&ctx->cursor, s->rules);
+}
+
+static void check_mismatch(struct check_ctx_t* const ctx, const char* const what, const int64_t unix_time, const schedule_current_state_t* const got,
+    const schedule_current_state_t* const ref)
+{
+    if (ctx->mismatches++ >= MAX_PRINTED_MISMATCHES)
+        return;
+    printf("FAIL %s %s: %s at %" PRId64 "\n", ctx->s->name, source_names[ctx->source], what, unix_time);
+    state_print("got", got);
+    state_print("reference", ref);
+}
+
+/** Evaluate the cursor (and for tables, the binary search) at a time, and compare with the reference scan */
+static void check_at(struct check_ctx_t* const ctx, const int64_t unix_time, const char* const what)
+{
+    const schedule_t* const table = ctx->s->table;
+    const schedule_current_state_t got = schedule_cursor_get_state(&ctx->cursor, unix_time);
+
+    /* Rules never end, so compare them only within the table, and only to the next entries that the table has */
+    const int64_t table_end = (int64_t)(table->epoch + table->entries[table->num_entries - 1].timestamp);
+    if (ctx->source == SOURCE_RULES && (unix_time <= (int64_t)table->epoch || unix_time >= table_end))
+        return;
+
+    schedule_current_state_t ref = schedule_get_state_scan(table, unix_time);
+    if (ctx->source == SOURCE_RULES)
+    {
+        if (ref.timestamp_region_next_on == UINT64_MAX)
+            ref.timestamp_region_next_on = got.timestamp_region_next_on;
+        if (ref.timestamp_region_next_off == UINT64_MAX)
+            ref.timestamp_region_next_off = got.timestamp_region_next_off;
+    }
+
+    ctx->checks++;
+    if (!state_equal(&got, &ref))
+        check_mismatch(ctx, what, unix_time, &got, &ref);
+
+    if (ctx->source == SOURCE_TABLE)
+    {
+        const schedule_current_state_t bsearch = schedule_get_state(table, unix_time);
+        ctx->checks++;
+        if (!state_equal(&bsearch, &ref))
+            check_mismatch(ctx, "binary search", unix_time, &bsearch, &ref);
+    }
+}
+
+static void check_source(const struct test_schedule_t* const s, const enum source_t source)
+{
+    struct check_ctx_t ctx = { 0 };
+    check_init(&ctx, s, source);
+
+    const schedule_t* const table = s->table;
+    const uint32_t num_boundaries = table->num_entries * NUM_BOUNDARY_OFFSETS;
+    const int64_t first = (int64_t)table->epoch - SCHEDULE_RULES_SECONDS_PER_DAY;
+    const int64_t last = boundary_time(table, num_boundaries - 1) + SCHEDULE_RULES_SECONDS_PER_DAY;
+
+    /* Forward, like the control loop (Boundaries of close entries overlap, so there are small steps back too) */
+    check_at(&ctx, first, "before first entry");
+    for (uint32_t i = 0; i < num_boundaries; i++)
+        check_at(&ctx, boundary_time(table, i), "forward");
+    check_at(&ctx, last, "after last entry");
+
+    /* Backwards, like a clock step from SNTP, from anywhere to anywhere earlier (including before the first entry) */
+    check_init(&ctx, s, source);
+    for (uint32_t i = 0; i < NUM_BACKWARD_JUMPS; i++)
+    {
+        const uint32_t from = (uint32_t)(rand64() % num_boundaries);
+        const uint32_t to = (uint32_t)(rand64() % (from + 1));
+        check_at(&ctx, boundary_time(table, from), "before jump back");
+        check_at(&ctx, i % 64 ? boundary_time(table, to) : first, "after jump back");
+        check_at(&ctx, boundary_time(table, to) + 1, "after jump back + 1");
+    }
+    check_at(&ctx, last, "after last entry");
+    check_at(&ctx, first, "jump back before first entry");
+
+    printf("%-8s %-7s %8u boundaries %8u checks %5u mismatches\n", s->name, source_names[source], num_boundaries, ctx.checks, ctx.mismatches);
+    failures += ctx.mismatches;
+}
+
+int main()
+{
+    for (size_t i = 0; i < sizeof(test_schedules) / sizeof(*test_schedules); i++)
+        for (int source = 0; source < SOURCE_COUNT; source++)
+            check_source(&test_schedules[i], source);
+
+    printf("%d failures\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
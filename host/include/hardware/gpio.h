@@ -0,0 +1,76 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Host stand-in for the pico-sdk hardware/gpio.h
+ *
+ * Outputs are recorded and inputs read their pull (or a level set with virtual_gpio_set_input())
+ */
+#pragma once
+
+#include "pico.h"
+
+#define NUM_BANK0_GPIOS 48
+
+enum gpio_dir
+{
+    GPIO_IN = 0,
+    GPIO_OUT = 1,
+};
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+void gpio_put_masked64(uint64_t mask, uint64_t value);
+bool gpio_get(uint gpio);
+void gpio_pull_up(uint gpio);
+void gpio_pull_down(uint gpio);
+
+/**
+ * Force the level read from an input, overriding its pull
+ */
+void virtual_gpio_set_input(uint gpio, bool value);
+
+/**
+ * Get the level last put to an output
+ */
+bool virtual_gpio_get_output(uint gpio);
+
+/**
+ * Set a function to call after every write to the outputs (NULL to remove it)
+ *
+ * Lets the caller check that no intermediate combination of output levels is ever visible
+ */
+void virtual_gpio_set_write_hook(void (*hook)(void));
+
+/**
+ * Reset every gpio, as a reboot would
+ *
+ * Inputs forced with virtual_gpio_set_input() keep their level
+ */
+void virtual_gpio_reset(void);
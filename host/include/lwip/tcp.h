@@ -0,0 +1,117 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Host stand-in for the lwIP raw TCP API, with one simulated client (see virtual_net_connect())
+ *
+ * Only what schedule_upload.c uses is provided. pbufs are never chained, pbuf_cat() appends to the first pbuf.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef int8_t err_t;
+
+#define ERR_OK 0
+#define ERR_VAL -6
+#define ERR_ABRT -13
+
+typedef struct
+{
+    uint32_t addr;
+} ip_addr_t;
+
+#define IPADDR_TYPE_ANY 46
+#define IP_ANY_TYPE NULL
+#define TCP_WRITE_FLAG_COPY 0x01
+
+struct pbuf
+{
+    struct pbuf* next;
+    void* payload;
+    uint16_t tot_len;
+    uint16_t len;
+};
+
+struct tcp_pcb;
+
+typedef err_t (*tcp_accept_fn)(void* arg, struct tcp_pcb* newpcb, err_t err);
+typedef err_t (*tcp_recv_fn)(void* arg, struct tcp_pcb* tpcb, struct pbuf* p, err_t err);
+typedef void (*tcp_err_fn)(void* arg, err_t err);
+
+struct tcp_pcb
+{
+    ip_addr_t remote_ip;
+    void* arg;
+    tcp_accept_fn accept;
+    tcp_recv_fn recv;
+    tcp_err_fn errf;
+    /** Replies written with tcp_write() */
+    char reply[256];
+    uint32_t reply_len;
+    /** Bytes the receiver handed back with tcp_recved() */
+    uint32_t recved;
+    bool closed;
+};
+
+struct tcp_pcb* tcp_new_ip_type(uint8_t type);
+err_t tcp_bind(struct tcp_pcb* pcb, const ip_addr_t* ipaddr, uint16_t port);
+struct tcp_pcb* tcp_listen_with_backlog(struct tcp_pcb* pcb, uint8_t backlog);
+void tcp_accept(struct tcp_pcb* pcb, tcp_accept_fn accept);
+void tcp_arg(struct tcp_pcb* pcb, void* arg);
+void tcp_recv(struct tcp_pcb* pcb, tcp_recv_fn recv);
+void tcp_err(struct tcp_pcb* pcb, tcp_err_fn err);
+void tcp_recved(struct tcp_pcb* pcb, uint16_t len);
+err_t tcp_write(struct tcp_pcb* pcb, const void* dataptr, uint16_t len, uint8_t apiflags);
+err_t tcp_output(struct tcp_pcb* pcb);
+err_t tcp_close(struct tcp_pcb* pcb);
+void tcp_abort(struct tcp_pcb* pcb);
+
+void pbuf_cat(struct pbuf* head, struct pbuf* tail);
+uint8_t pbuf_free(struct pbuf* p);
+uint16_t pbuf_copy_partial(const struct pbuf* p, void* dataptr, uint16_t len, uint16_t offset);
+
+const char* ipaddr_ntoa(const ip_addr_t* addr);
+
+/**
+ * Connect the simulated client to the listening pcb
+ *
+ * @returns The connection, or NULL if nothing listens or the connection was refused
+ */
+struct tcp_pcb* virtual_net_connect(void);
+
+/**
+ * Deliver data from the simulated client, as one segment
+ */
+void virtual_net_send(struct tcp_pcb* pcb, const void* data, uint16_t len);
+
+/**
+ * Close the connection from the simulated client's side
+ */
+void virtual_net_close(struct tcp_pcb* pcb);
@@ -0,0 +1,56 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Host stand-in for the pico-sdk pico/time.h, backed by the virtual clock (see virtual_clock.h)
+ */
+#pragma once
+
+#include "pico.h"
+
+uint64_t time_us_64(void);
+
+typedef uint64_t absolute_time_t;
+static inline absolute_time_t from_us_since_boot(const uint64_t us) { return us; }
+
+#define PICO_TIME_DEFAULT_ALARM_POOL_MAX_TIMERS 16
+
+/* Alarms are kept and fired by the virtual clock (see virtual_clock.c), with the same return value convention as the SDK */
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void* user_data);
+typedef struct alarm_pool alarm_pool_t;
+
+/** There is a single pool on the host, every call returns it */
+alarm_pool_t* alarm_pool_create_with_unused_hardware_alarm(const uint max_timers);
+
+/**
+ * @returns Alarm id (> 0), 0 if time has already passed and fire_if_past is false, or -1 if the pool is full
+ */
+alarm_id_t alarm_pool_add_alarm_at(alarm_pool_t* pool, absolute_time_t time, alarm_callback_t callback, void* user_data, bool fire_if_past);
+
+bool alarm_pool_cancel_alarm(alarm_pool_t* pool, alarm_id_t alarm_id);
@@ -0,0 +1,292 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Bound the error of the actuator position estimate against a simulated actuator
+ *
+ * Drives one actuator through random triggers and reboots (some of them mid-cycle) on the virtual clock, while a
+ * plant model moves a simulated actuator from the GPIO outputs. Every movement runs at a random speed within
+ * +/- --tolerance of nominal, and the actuator stops at its end stops.
+ *
+ * ACTUATOR_TRAVEL_TIME is taken as the full travel time of the slowest actuator, so a full retract always gets home.
+ *
+ * Checks that:
+ * - The estimate (actuator_get_position()) stays within 2 * tolerance * stroke of the simulated position, as the
+ *   extend and the retract can each be off by up to tolerance * stroke
+ * - The simulated actuator is home after every cycle, ie. ACTUATOR_POSITION_MARGIN covers the speed differences
+ */
+#include "actuator.h"
+#include "virtual_clock.h"
+
+#include "config.h"
+
+#include "hardware/gpio.h"
+
+#include <getopt.h>
+#include <math.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Interval (in microseconds) at which the estimate is compared between output changes */
+#define SAMPLE_INTERVAL (10ull * 1000ull)
+
+static struct
+{
+    double tolerance;
+    uint64_t stroke;
+    uint32_t cycles;
+    uint64_t seed;
+} opts = { 0.04, ACTUATOR_STROKE_TIME, 10000, 1 };
+
+/** Simulated actuator */
+static struct
+{
+    /** Extension (in microseconds of travel at nominal speed) */
+    double position;
+    /** End stop, ACTUATOR_TRAVEL_TIME at the slowest speed */
+    double length;
+    /** Speed of the current movement, relative to nominal */
+    double speed;
+    /** Direction of the current movement (-1: Retracting, 0: Idle, 1: Extending) */
+    int direction;
+} plant;
+
+static struct
+{
+    uint32_t cycles;
+    uint32_t boots;
+    uint32_t boot_retracts_skipped;
+    uint32_t not_home;
+    uint64_t samples;
+    double max_error;
+    /** Cycles that ran to completion without a reboot, and their total time (in microseconds) */
+    uint32_t completed;
+    uint64_t cycle_time;
+} counts;
+
+static struct actuator_t actuator;
+/** The estimate is only meaningful once a boot with an unknown position has retracted */
+static bool estimate_valid;
+
+/** xorshift64 */
+static uint64_t random_next()
+{
+    opts.seed ^= opts.seed << 13;
+    opts.seed ^= opts.seed >> 7;
+    opts.seed ^= opts.seed << 17;
+    return opts.seed;
+}
+
+/** Uniform in [lo, hi) */
+static double random_range(const double lo, const double hi) { return lo + (hi - lo) * (double)(random_next() >> 11) / (double)(1ull << 53); }
+
+/** Move the simulated actuator for dt microseconds at the current outputs */
+static void plant_advance(const uint64_t dt)
+{
+    const bool extend = gpio_get(actuator.conf.gpio_extend) == actuator.conf.logic_active_level_extend;
+    const bool retract = gpio_get(actuator.conf.gpio_retract) == actuator.conf.logic_active_level_retract;
+    const int direction = extend == retract ? 0 : (extend ? 1 : -1);
+    /* Every movement gets its own speed */
+    if (direction != plant.direction && direction)
+        plant.speed = random_range(1.0 - opts.tolerance, 1.0 + opts.tolerance);
+    plant.direction = direction;
+
+    plant.position += (double)direction * plant.speed * (double)dt;
+    if (plant.position < 0.0)
+        plant.position = 0.0;
+    if (plant.position > plant.length)
+        plant.position = plant.length;
+}
+
+static void sample()
+{
+    if (!estimate_valid)
+        return;
+    counts.samples++;
+    const double error = fabs((double)actuator_get_position(&actuator) - plant.position);
+    if (error > counts.max_error)
+        counts.max_error = error;
+}
+
+/** Run the actuator and the simulated actuator until time_us_64() reaches end */
+static void run_until(const uint64_t end)
+{
+    for (uint64_t cur = time_us_64(); cur < end; cur = time_us_64())
+    {
+        const bool in_cycle = actuator_in_cycle(&actuator);
+        uint64_t next = end;
+        /* actuator_poll() only switches once the edge has passed */
+        const uint64_t edge = actuator_next_edge(&actuator);
+        if (edge != UINT64_MAX && edge + 1 < next)
+            next = edge + 1;
+        if (cur + SAMPLE_INTERVAL < next)
+            next = cur + SAMPLE_INTERVAL;
+
+        plant_advance(next - cur);
+        virtual_clock_advance_to(next);
+        actuator_poll(&actuator);
+        sample();
+
+        if (in_cycle && !actuator_in_cycle(&actuator))
+        {
+            /* Retracting the estimate is exact: a valid estimate is 0 now, and so must the simulated actuator be */
+            if (plant.position > 0.0)
+            {
+                fprintf(stderr, "Cycle %u: not home, %.0f us of travel left (estimate %" PRIu64 " us)\n", counts.cycles, plant.position,
+                    actuator_get_position(&actuator));
+                counts.not_home++;
+            }
+            estimate_valid = true;
+        }
+    }
+}
+
+/** Boot like main_core1(), with a position kept from before the reboot (or -1 if unknown) */
+static void boot(const int64_t retained)
+{
+    counts.boots++;
+    struct actuator_config_t cinfo = {};
+    cinfo.time_travel = ACTUATOR_TRAVEL_TIME;
+    cinfo.time_rest = ACTUATOR_REST_TIME;
+    cinfo.time_stroke = opts.stroke;
+    cinfo.time_margin = ACTUATOR_POSITION_MARGIN;
+    cinfo.initial_position = retained;
+    cinfo.gpio_extend = ACTUATOR_GPIO_ACT_ON_EXTEND;
+    cinfo.gpio_retract = ACTUATOR_GPIO_ACT_ON_RETRACT;
+    cinfo.logic_active_level_extend = ACTUATOR_ACTIVE_LOGIC_LEVEL_EXTEND;
+    cinfo.logic_active_level_retract = ACTUATOR_ACTIVE_LOGIC_LEVEL_RETRACT;
+    if (!actuator_init(&actuator, &cinfo))
+    {
+        fprintf(stderr, "Unable to initialize the actuator\n");
+        exit(EXIT_FAILURE);
+    }
+    if (!actuator_in_cycle(&actuator))
+        counts.boot_retracts_skipped++;
+    estimate_valid = retained >= 0;
+}
+
+static void usage(const char* argv0)
+{
+    fprintf(stderr,
+        "Usage: %s [OPTIONS]\n"
+        "Bound the error of the actuator position estimate against a simulated actuator\n"
+        "\n"
+        "  -t, --tolerance T  Speed of each movement within +/- T of nominal (default: 0.04)\n"
+        "  -s, --stroke US    Stroke time in microseconds (default: ACTUATOR_STROKE_TIME)\n"
+        "  -c, --cycles N     Number of triggers (default: 10000)\n"
+        "  -r, --seed N       Random seed (default: 1)\n",
+        argv0);
+}
+
+int main(int argc, char** argv)
+{
+    static const struct option long_options[] = {
+        { "tolerance", required_argument, NULL, 't' },
+        { "stroke", required_argument, NULL, 's' },
+        { "cycles", required_argument, NULL, 'c' },
+        { "seed", required_argument, NULL, 'r' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "t:s:c:r:h", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+        case 't':
+            opts.tolerance = strtod(optarg, NULL);
+            break;
+        case 's':
+            opts.stroke = strtoull(optarg, NULL, 0);
+            break;
+        case 'c':
+            opts.cycles = strtoul(optarg, NULL, 0);
+            break;
+        case 'r':
+            opts.seed = strtoull(optarg, NULL, 0);
+            break;
+        default:
+            usage(argv[0]);
+            return c == 'h' ? 0 : 1;
+        }
+    }
+    if (opts.tolerance < 0.0 || opts.tolerance >= 1.0 || !opts.stroke || opts.stroke > ACTUATOR_TRAVEL_TIME || !opts.seed)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    plant.length = (double)ACTUATOR_TRAVEL_TIME * (1.0 - opts.tolerance);
+    /* Nothing is known about the actuator on the first power up */
+    plant.position = random_range(0.0, plant.length);
+    boot(-1);
+
+    const uint64_t full_cycle = 2 * (ACTUATOR_REST_TIME + ACTUATOR_TRAVEL_TIME);
+    while (counts.cycles < opts.cycles)
+    {
+        run_until(time_us_64() + (uint64_t)random_range(0.0, (double)full_cycle));
+        if (!actuator_in_cycle(&actuator))
+        {
+            const uint64_t start = time_us_64();
+            actuator_trigger(&actuator);
+            counts.cycles++;
+            run_until(time_us_64() + (uint64_t)random_range(0.0, 1.5 * (double)full_cycle));
+            if (!actuator_in_cycle(&actuator))
+            {
+                counts.completed++;
+                counts.cycle_time += actuator.timestamp_end_retract - start;
+            }
+        }
+
+        /* A reboot in the middle of a cycle loses the position, like a watchdog reset during one on the RP2350 */
+        if (random_next() % 8 == 0)
+        {
+            const int64_t retained = actuator_in_cycle(&actuator) ? -1 : (int64_t)actuator_get_position(&actuator);
+            virtual_clock_reboot();
+            virtual_gpio_reset();
+            boot(ACTUATOR_RETAIN_POSITION ? retained : -1);
+        }
+    }
+    run_until(time_us_64() + full_cycle);
+
+    const double bound = 2.0 * opts.tolerance * (double)opts.stroke;
+    /* Home is only guaranteed with margin >= stroke * 2t / (1 - t), or a retract clamped to a full travel */
+    double margin_needed = (double)opts.stroke * 2.0 * opts.tolerance / (1.0 - opts.tolerance);
+    if (margin_needed > (double)(ACTUATOR_TRAVEL_TIME - opts.stroke))
+        margin_needed = (double)(ACTUATOR_TRAVEL_TIME - opts.stroke);
+    printf("%u cycles, %u boots (%u retracts skipped), %" PRIu64 " samples\n", counts.cycles, counts.boots, counts.boot_retracts_skipped,
+        counts.samples);
+    printf("Mean completed cycle: %.3f s (full travel cycle: %.3f s)\n", (double)counts.cycle_time / 1e6 / (counts.completed ? counts.completed : 1),
+        (double)full_cycle / 1e6);
+    printf("Max estimate error: %.0f us (bound %.0f us)\n", counts.max_error, bound);
+    printf("Not home after a cycle: %u (margin %" PRIu64 " us, needed %.0f us)\n", counts.not_home, (uint64_t)ACTUATOR_POSITION_MARGIN, margin_needed);
+
+    return counts.max_error > bound + 1.0 || counts.not_home ? 1 : 0;
+}
@@ -0,0 +1,531 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Replay the core 1 control logic against a virtual clock
+ *
+ * Runs the zone, schedule, and actuator code from main_core1.c on the host, jumping the virtual clock straight from one
+ * event (schedule change, actuator phase change, automatic reboot) to the next, and prints every actuation.
+ *
+ * Differences from the firmware:
+ * - Booting (USB stdio wait, i2c power cycle, network connection, SNTP sync) takes no time
+ * - The schedule partition is not used, built-in schedules are selected with --source
+ */
+#include "actuator.h"
+#include "ftime.h"
+#include "schedule.h"
+#include "schedule_packed.h"
+#include "schedule_rules.h"
+#include "vcd.h"
+#include "virtual_clock.h"
+#include "zone.h"
+
+#include "config.h"
+
+#include "schedule_level_1.h"
+#include "schedule_level_1_packed.h"
+#include "schedule_level_1_rules.h"
+#include "schedule_level_2.h"
+#include "schedule_level_2_packed.h"
+#include "schedule_level_2_rules.h"
+
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hardware/gpio.h"
+#include "pico/time.h"
+
+#define ZONE_COUNT(...) +1
+#define ACTUATOR_COUNT(...) +1
+#define NUM_ZONES (0 ZONE_TABLE(ZONE_COUNT))
+#define NUM_ACTUATORS (0 ACTUATOR_TABLE(ACTUATOR_COUNT))
+
+#define ZONE_CONFIG(level, gpio_select, select_active_level, actuator_on, actuator_off, trigger_policy, trigger_cycles) \
+    { "L" #level, gpio_select, select_active_level, actuator_on, actuator_off, trigger_policy, trigger_cycles },
+static const struct zone_config_t zone_configs[NUM_ZONES] = { ZONE_TABLE(ZONE_CONFIG) };
+
+#define ACTUATOR_GPIOS(gpio_extend, gpio_retract) { gpio_extend, gpio_retract },
+static const uint8_t actuator_gpios[NUM_ACTUATORS][2] = { ACTUATOR_TABLE(ACTUATOR_GPIOS) };
+
+#define ZONE_BUILTIN_TABLE(level, ...) &schedule_level_##level,
+#define ZONE_BUILTIN_RULES(level, ...) &schedule_level_##level##_rules,
+#define ZONE_BUILTIN_PACKED(level, ...) &schedule_level_##level##_packed,
+static const schedule_t* const builtin_tables[NUM_ZONES] = { ZONE_TABLE(ZONE_BUILTIN_TABLE) };
+static const schedule_rules_t* const builtin_rules[NUM_ZONES] = { ZONE_TABLE(ZONE_BUILTIN_RULES) };
+static const schedule_packed_t* const builtin_packed[NUM_ZONES] = { ZONE_TABLE(ZONE_BUILTIN_PACKED) };
+
+static struct actuator_t actuators[NUM_ACTUATORS];
+static struct zone_t zones[NUM_ZONES];
+
+enum actuator_phase_t
+{
+    PHASE_IDLE,
+    PHASE_EXTEND,
+    PHASE_RETRACT,
+};
+static const char* const phase_names[] = { "idle", "extend", "retract" };
+static enum actuator_phase_t actuator_phases[NUM_ACTUATORS];
+/** Number of actuators initialized since the last boot, the others have no valid configuration yet */
+static size_t actuators_initialized;
+/** Positions kept across reboots like the retained RAM in main_core1(), unknown (-1) before the first boot */
+static int64_t retained_positions[NUM_ACTUATORS];
+
+static struct
+{
+    int source;
+    bool select_level;
+    bool reboot;
+    bool quiet;
+    const char* vcd;
+    /** Unix time (in microseconds) that the VCD file starts at */
+    microseconds_t vcd_start;
+} opts = { SCHEDULE_SOURCE, 1, true, false, NULL, 0 };
+
+static struct
+{
+    uint32_t boots;
+    uint32_t triggers;
+    uint32_t resumes;
+    uint32_t phase_changes;
+    /** Largest lateness (in microseconds) of any actuator output change */
+    uint32_t max_lateness_us;
+    /** GPIO writes and the writes that left the outputs in a forbidden combination (see check_interlock()) */
+    uint32_t gpio_writes;
+    uint32_t interlock_violations;
+    /** Zone command counters of every boot so far (see collect_command_stats()) */
+    struct zone_command_stats_t commands;
+    uint32_t steps;
+} counts;
+
+static char fbuf[128];
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((format(__printf__, 1, 2)))
+#endif
+static void emit(const char* fmt, ...)
+{
+    if (opts.quiet)
+        return;
+    va_list args;
+    va_start(args, fmt);
+    printf("%s ", ftime_us(get_unix_time(), fbuf, sizeof(fbuf)));
+    vprintf(fmt, args);
+    va_end(args);
+}
+
+static bool actuator_extending(const struct actuator_t* const a) { return virtual_gpio_get_output(a->conf.gpio_extend) == a->conf.logic_active_level_extend; }
+
+static bool actuator_retracting(const struct actuator_t* const a)
+{
+    return virtual_gpio_get_output(a->conf.gpio_retract) == a->conf.logic_active_level_retract;
+}
+
+/**
+ * GPIO write hook, checks the outputs after every single write
+ *
+ * An actuator must never be driven in both directions, and the "ON" and "OFF" actuators of a zone must never extend
+ * (press the switch) at the same time, not even for the duration of one write. Retracting together is expected (as
+ * every actuator retracts on boot), unless @ref ACTUATOR_GROUP_EXCLUSIVE_ENERGIZE forbids energizing them together.
+ */
+static void check_interlock(void)
+{
+    counts.gpio_writes++;
+    vcd_sample((uint64_t)(get_unix_time() - opts.vcd_start));
+    bool extending[NUM_ACTUATORS] = { 0 };
+    bool energized[NUM_ACTUATORS] = { 0 };
+    for (size_t i = 0; i < actuators_initialized; i++)
+    {
+        extending[i] = actuator_extending(&actuators[i]);
+        energized[i] = extending[i] || actuator_retracting(&actuators[i]);
+        if (extending[i] && actuator_retracting(&actuators[i]))
+        {
+            emit("interlock violation: actuator %zu extending and retracting\n", i);
+            counts.interlock_violations++;
+        }
+    }
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        if (extending[zone_configs[i].actuator_on] && extending[zone_configs[i].actuator_off] && zone_configs[i].actuator_on != zone_configs[i].actuator_off)
+        {
+            emit("interlock violation: zone %s ON and OFF actuators extending\n", zone_configs[i].name);
+            counts.interlock_violations++;
+        }
+        if (ACTUATOR_GROUP_EXCLUSIVE_ENERGIZE && energized[zone_configs[i].actuator_on] && energized[zone_configs[i].actuator_off]
+            && zone_configs[i].actuator_on != zone_configs[i].actuator_off)
+        {
+            emit("interlock violation: zone %s ON and OFF actuators energized\n", zone_configs[i].name);
+            counts.interlock_violations++;
+        }
+    }
+}
+
+/** Equivalent of actuators_poll() in main_core1.c, but reports phase changes */
+static void actuators_poll()
+{
+    actuator_poll_all();
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        enum actuator_phase_t phase = PHASE_IDLE;
+        if (actuator_extending(&actuators[i]))
+            phase = PHASE_EXTEND;
+        else if (actuator_retracting(&actuators[i]))
+            phase = PHASE_RETRACT;
+
+        if (phase != actuator_phases[i])
+        {
+            emit("actuator %zu %s\n", i, phase_names[phase]);
+            actuator_phases[i] = phase;
+            counts.phase_changes++;
+
+            struct actuator_jitter_t j;
+            actuator_get_jitter(&actuators[i], &j);
+            if (j.last_us > counts.max_lateness_us)
+                counts.max_lateness_us = j.last_us;
+        }
+    }
+}
+
+static bool actuators_in_cycle()
+{
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        if (actuator_in_cycle(&actuators[i]))
+            return true;
+    return false;
+}
+
+/** Time (in microseconds since boot) of the next actuator phase change, capped at limit */
+static uint64_t actuators_next_deadline(uint64_t limit)
+{
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        /* actuator_poll() only switches once the edge has passed */
+        const uint64_t edge = actuator_next_edge(&actuators[i]);
+        if (edge != UINT64_MAX && edge + 1 < limit)
+            limit = edge + 1;
+    }
+    return limit;
+}
+
+static void init_schedule_cursors()
+{
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        if (opts.source == SCHEDULE_SOURCE_TABLES)
+            schedule_cursor_init(&zones[i].cursor, builtin_tables[i]);
+        else if (opts.source == SCHEDULE_SOURCE_RULES)
+            schedule_cursor_init_rules(&zones[i].cursor, builtin_rules[i]);
+        else
+            schedule_cursor_init_packed(&zones[i].cursor, builtin_packed[i]);
+    }
+}
+
+/** Everything main_core1() does before its loop */
+static void boot()
+{
+    counts.boots++;
+    emit("boot\n");
+
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        zone_init(&zones[i], &zone_configs[i]);
+        emit("zone %s %s\n", zones[i].conf.name, zones[i].enabled ? "enabled" : "disabled");
+    }
+
+    actuators_initialized = 0;
+    struct actuator_config_t cinfo = {};
+    cinfo.time_travel = ACTUATOR_TRAVEL_TIME;
+    cinfo.time_rest = ACTUATOR_REST_TIME;
+    cinfo.logic_active_level_extend = ACTUATOR_ACTIVE_LOGIC_LEVEL_EXTEND;
+    cinfo.logic_active_level_retract = ACTUATOR_ACTIVE_LOGIC_LEVEL_RETRACT;
+    cinfo.time_stroke = ACTUATOR_STROKE_TIME;
+    cinfo.time_margin = ACTUATOR_POSITION_MARGIN;
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        cinfo.gpio_extend = actuator_gpios[i][0];
+        cinfo.gpio_retract = actuator_gpios[i][1];
+        cinfo.initial_position = ACTUATOR_RETAIN_POSITION ? retained_positions[i] : -1;
+        if (!actuator_init(&actuators[i], &cinfo))
+        {
+            fprintf(stderr, "Actuator %zu: Unable to initialize\n", i);
+            exit(EXIT_FAILURE);
+        }
+        actuators_initialized++;
+        /* Same stagger as main_core1() */
+        if (ACTUATOR_GROUP_EXCLUSIVE_ENERGIZE && actuator_in_cycle(&actuators[i]))
+            cinfo.time_init_delay = actuators[i].timestamp_end_retract + ACTUATOR_REST_TIME - time_us_64();
+        actuator_phases[i] = PHASE_IDLE;
+    }
+    actuators_poll();
+
+    while (actuators_in_cycle())
+    {
+        virtual_clock_advance_to(actuators_next_deadline(UINT64_MAX));
+        actuators_poll();
+    }
+
+    init_schedule_cursors();
+    const uint64_t unix_time = get_unix_time() / 1000000;
+    for (size_t i = 0; i < NUM_ZONES; i++)
+        zone_update(&zones[i], unix_time);
+
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        if (zone_resume(&zones[i], actuators))
+        {
+            emit("zone %s resume %s\n", zones[i].conf.name, zones[i].state.on ? "ON" : "OFF");
+            counts.resumes++;
+        }
+    }
+}
+
+/** Add the zone command counters to counts.commands, must be called before zone_init() clears them */
+static void collect_command_stats()
+{
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        const struct zone_command_stats_t* const s = &zones[i].command_stats;
+        counts.commands.requests += s->requests;
+        counts.commands.coalesced += s->coalesced;
+        counts.commands.superseded += s->superseded;
+        counts.commands.expired += s->expired;
+        counts.commands.executed += s->executed;
+        counts.commands.held_off += s->held_off;
+    }
+}
+
+/** Same condition as the automatic reboot in main_core1() */
+static bool reboot_due(const uint64_t unix_time)
+{
+    if (!opts.reboot || time_us_64() / 1000000ull <= AUTOMATIC_REBOOT_INTERVAL || actuators_in_cycle())
+        return false;
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        const schedule_current_state_t* const s = &zones[i].state;
+        if (s->in_region || zones[i].command.pending //
+            || s->timestamp_region_next_on - unix_time <= AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION
+            || s->timestamp_region_next_off - unix_time <= AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION)
+            return false;
+    }
+    return true;
+}
+
+/** Time (in microseconds since boot) at which the main loop of main_core1() next has something to do */
+static uint64_t next_deadline(const uint64_t end_us)
+{
+    const uint64_t cur = time_us_64();
+    const microseconds_t unix_time_us = get_unix_time();
+    uint64_t next = actuators_next_deadline(end_us);
+
+    if (opts.reboot && cur / 1000000ull <= AUTOMATIC_REBOOT_INTERVAL && (AUTOMATIC_REBOOT_INTERVAL + 1ull) * 1000000ull < next)
+        next = (AUTOMATIC_REBOOT_INTERVAL + 1ull) * 1000000ull;
+
+    /* Disabled zones are included as they can hold off automatic reboots */
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        const uint64_t change = zone_next_change(&zones[i]);
+        if (change == UINT64_MAX)
+            continue;
+        const microseconds_t change_us = (microseconds_t)change * MICROSECONDS_PER_SECOND;
+        if (change_us <= unix_time_us)
+            return cur + 1;
+        if ((uint64_t)(change_us - unix_time_us) < next - cur)
+            next = cur + (change_us - unix_time_us);
+    }
+
+    return next;
+}
+
+/** Parse YYYY-MM-DD as local midnight (standard time) */
+static bool parse_date(const char* s, microseconds_t* const out)
+{
+    struct tm tm = {};
+    if (!strptime(s, "%Y-%m-%d", &tm))
+        return false;
+    *out = ((microseconds_t)timegm(&tm) - TIMEZONE_OFFSET_ST) * MICROSECONDS_PER_SECOND;
+    return true;
+}
+
+static void usage(const char* argv0)
+{
+    fprintf(stderr,
+        "Usage: %s [OPTIONS]\n"
+        "Replay the core 1 control logic and print every actuation\n"
+        "\n"
+        "  -s, --start DATE     Local date to boot at, as YYYY-MM-DD (default: first entry of the level 1 table)\n"
+        "  -d, --days N         Number of days to replay (default: 365)\n"
+        "  -p, --select LEVEL   Level read from the select gpios, 1 selects L1, 0 selects L2 (default: 1)\n"
+        "  -S, --source SOURCE  Built-in schedules to use: tables, rules, or packed (default: SCHEDULE_SOURCE)\n"
+        "  -n, --no-reboot      Disable automatic reboots\n"
+        "  -q, --quiet          Only print the summary\n"
+        "  -o, --vcd FILE       Write the actuator outputs to a VCD file, timed from the start date\n",
+        argv0);
+}
+
+int main(int argc, char** argv)
+{
+    microseconds_t start = ((microseconds_t)schedule_level_1.epoch + schedule_level_1.entries[0].timestamp) * MICROSECONDS_PER_SECOND;
+    long days = 365;
+
+    static const struct option long_options[] = {
+        { "start", required_argument, NULL, 's' },
+        { "days", required_argument, NULL, 'd' },
+        { "select", required_argument, NULL, 'p' },
+        { "source", required_argument, NULL, 'S' },
+        { "no-reboot", no_argument, NULL, 'n' },
+        { "quiet", no_argument, NULL, 'q' },
+        { "vcd", required_argument, NULL, 'o' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "s:d:p:S:nqo:h", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+        case 's':
+            if (!parse_date(optarg, &start))
+            {
+                fprintf(stderr, "Invalid date '%s'\n", optarg);
+                return 1;
+            }
+            break;
+        case 'd':
+            days = strtol(optarg, NULL, 0);
+            break;
+        case 'p':
+            opts.select_level = strtol(optarg, NULL, 0) != 0;
+            break;
+        case 'S':
+            if (!strcmp(optarg, "tables"))
+                opts.source = SCHEDULE_SOURCE_TABLES;
+            else if (!strcmp(optarg, "rules"))
+                opts.source = SCHEDULE_SOURCE_RULES;
+            else if (!strcmp(optarg, "packed"))
+                opts.source = SCHEDULE_SOURCE_PACKED;
+            else
+            {
+                fprintf(stderr, "Unknown schedule source '%s'\n", optarg);
+                return 1;
+            }
+            break;
+        case 'n':
+            opts.reboot = false;
+            break;
+        case 'q':
+            opts.quiet = true;
+            break;
+        case 'o':
+            opts.vcd = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return c == 'h' ? 0 : 1;
+        }
+    }
+
+    if (opts.vcd)
+    {
+        if (!vcd_open(opts.vcd, "actuators"))
+        {
+            fprintf(stderr, "Unable to create %s\n", opts.vcd);
+            return 1;
+        }
+        opts.vcd_start = start;
+        char name[32];
+        for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        {
+            snprintf(name, sizeof(name), "actuator%zu_extend", i);
+            vcd_add_gpio(actuator_gpios[i][0], name);
+            snprintf(name, sizeof(name), "actuator%zu_retract", i);
+            vcd_add_gpio(actuator_gpios[i][1], name);
+        }
+    }
+
+    struct timespec wall_start;
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+
+    for (size_t i = 0; i < NUM_ZONES; i++)
+        virtual_gpio_set_input(zone_configs[i].gpio_select, opts.select_level);
+    virtual_gpio_set_write_hook(check_interlock);
+
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        retained_positions[i] = -1;
+    set_unix_time(start);
+    const microseconds_t end = start + days * MICROSECONDS_PER_DAY;
+    boot();
+
+    while (get_unix_time() < end)
+    {
+        counts.steps++;
+        const uint64_t unix_time = get_unix_time() / 1000000;
+        for (size_t i = 0; i < NUM_ZONES; i++)
+            zone_update(&zones[i], unix_time);
+
+        for (size_t i = 0; i < NUM_ZONES; i++)
+        {
+            if (zone_poll(&zones[i], actuators, unix_time))
+            {
+                emit("zone %s trigger %s\n", zones[i].conf.name, zones[i].command.on ? "ON" : "OFF");
+                counts.triggers++;
+            }
+        }
+
+        if (reboot_due(unix_time))
+        {
+            /* Reboots only happen with every actuator idle, so the retained positions are always valid */
+            for (size_t i = 0; i < NUM_ACTUATORS; i++)
+                retained_positions[i] = (int64_t)actuator_get_position(&actuators[i]);
+            collect_command_stats();
+            virtual_clock_reboot();
+            virtual_gpio_reset();
+            boot();
+            continue;
+        }
+
+        actuators_poll();
+        virtual_clock_advance_to(next_deadline(time_us_64() + (uint64_t)(end - get_unix_time())));
+    }
+
+    struct timespec wall_end;
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    vcd_close();
+    const double wall = (double)(wall_end.tv_sec - wall_start.tv_sec) + (double)(wall_end.tv_nsec - wall_start.tv_nsec) / 1e9;
+
+    fprintf(stderr, "Replayed %ld days in %.3f ms (%u steps): %u boots, %u resumes, %u triggers, %u actuator phase changes (max %u us late)\n",
+        days, wall * 1e3, counts.steps, counts.boots, counts.resumes, counts.triggers, counts.phase_changes, counts.max_lateness_us);
+    collect_command_stats();
+    fprintf(stderr, "%u GPIO writes, %u interlock violations\n", counts.gpio_writes, counts.interlock_violations);
+    fprintf(stderr, "%u commands: %u run, %u coalesced, %u superseded, %u expired, %u regions held off\n", counts.commands.requests,
+        counts.commands.executed, counts.commands.coalesced, counts.commands.superseded, counts.commands.expired, counts.commands.held_off);
+    return counts.interlock_violations ? 1 : 0;
+}
@@ -0,0 +1,394 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Check the output timing of the actuator code against its configuration
+ *
+ * Runs every actuator of ACTUATOR_TABLE through back to back extend-retract cycles on the virtual clock, with a
+ * random idle gap in between, and watches every GPIO write. Each cycle must produce exactly:
+ * - The rest (ACTUATOR_REST_TIME) from the trigger to the extend
+ * - The extend (--stroke) at ACTUATOR_ACTIVE_LOGIC_LEVEL_EXTEND
+ * - The rest between the directions
+ * - The retract (stroke + ACTUATOR_POSITION_MARGIN, at most ACTUATOR_TRAVEL_TIME) at ACTUATOR_ACTIVE_LOGIC_LEVEL_RETRACT
+ *
+ * Every change must land within --slack of its due time (actuator_poll() only switches once the edge has passed, so
+ * polling right after every edge is 1 us late), never early, and an actuator must never be driven both ways.
+ *
+ * With --alarm-latency the outputs are only switched by the timer alarms of @ref ACTUATOR_ALARM_EDGES (actuator_poll() is
+ * never called), and every alarm callback runs that much after its target. Changes may then also be late by the
+ * latency, but no more, so a latency that adds up from one edge to the next is caught.
+ *
+ * With --vcd the pin levels are also written to a VCD file, for viewing in a waveform viewer
+ */
+#include "actuator.h"
+#include "vcd.h"
+#include "virtual_clock.h"
+
+#include "config.h"
+
+#include "hardware/gpio.h"
+#include "pico/time.h"
+
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ACTUATOR_COUNT(...) +1
+#define NUM_ACTUATORS (0 ACTUATOR_TABLE(ACTUATOR_COUNT))
+
+#define ACTUATOR_GPIOS(gpio_extend, gpio_retract) { gpio_extend, gpio_retract },
+static const uint8_t actuator_gpios[NUM_ACTUATORS][2] = { ACTUATOR_TABLE(ACTUATOR_GPIOS) };
+
+static struct
+{
+    uint64_t stroke;
+    uint32_t cycles;
+    uint64_t slack;
+    uint64_t seed;
+    /** 0 to poll the outputs, otherwise the latency of the alarm callbacks */
+    uint64_t alarm_latency;
+    const char* vcd;
+} opts = { ACTUATOR_STROKE_TIME, 1000000, 1, 1, 0, NULL };
+
+/** Output change that a checker expects next */
+enum expect_t
+{
+    EXPECT_NONE,
+    EXPECT_EXTEND_ON,
+    EXPECT_EXTEND_OFF,
+    EXPECT_RETRACT_ON,
+    EXPECT_RETRACT_OFF,
+};
+static const char* const expect_names[] = { "none", "extend on", "extend off", "retract on", "retract off" };
+
+/** Independent model of what the outputs of an actuator must do */
+static struct
+{
+    enum expect_t expect;
+    /** Due times (in microseconds since boot) of the changes of the current cycle, indexed by enum expect_t */
+    uint64_t due[5];
+    bool extending;
+    bool retracting;
+} checkers[NUM_ACTUATORS];
+
+static struct
+{
+    uint32_t cycles;
+    uint64_t edges;
+    uint64_t gpio_writes;
+    uint64_t max_lateness;
+    uint32_t early;
+    uint32_t late;
+    uint32_t unexpected;
+    uint32_t both_ways;
+} counts;
+
+static struct actuator_t actuators[NUM_ACTUATORS];
+
+/** xorshift64 */
+static uint64_t random_next()
+{
+    opts.seed ^= opts.seed << 13;
+    opts.seed ^= opts.seed >> 7;
+    opts.seed ^= opts.seed << 17;
+    return opts.seed;
+}
+
+/** Retract time for a cycle from home, same as actuator_trigger() */
+static uint64_t expected_retract()
+{
+    const uint64_t t = opts.stroke + ACTUATOR_POSITION_MARGIN;
+    return t < ACTUATOR_TRAVEL_TIME ? t : ACTUATOR_TRAVEL_TIME;
+}
+
+/** Expect a cycle from home triggered at cur */
+static void expect_cycle(const size_t i, const uint64_t cur)
+{
+    uint64_t* const due = checkers[i].due;
+    due[EXPECT_EXTEND_ON] = cur + ACTUATOR_REST_TIME;
+    due[EXPECT_EXTEND_OFF] = due[EXPECT_EXTEND_ON] + opts.stroke;
+    due[EXPECT_RETRACT_ON] = due[EXPECT_EXTEND_OFF] + ACTUATOR_REST_TIME;
+    due[EXPECT_RETRACT_OFF] = due[EXPECT_RETRACT_ON] + expected_retract();
+    checkers[i].expect = EXPECT_EXTEND_ON;
+}
+
+/** Compare a change of the outputs of actuator i against the model */
+static void check_change(const size_t i, const enum expect_t change, const uint64_t cur)
+{
+    if (change != checkers[i].expect)
+    {
+        fprintf(stderr, "Actuator %zu at %" PRIu64 " us: %s, expected %s\n", i, cur, expect_names[change], expect_names[checkers[i].expect]);
+        counts.unexpected++;
+        return;
+    }
+    counts.edges++;
+    const uint64_t due = checkers[i].due[change];
+    if (cur < due)
+    {
+        fprintf(stderr, "Actuator %zu at %" PRIu64 " us: %s %" PRIu64 " us early\n", i, cur, expect_names[change], due - cur);
+        counts.early++;
+    }
+    else
+    {
+        if (cur - due > counts.max_lateness)
+            counts.max_lateness = cur - due;
+        if (cur - due > opts.slack + opts.alarm_latency)
+        {
+            fprintf(stderr, "Actuator %zu at %" PRIu64 " us: %s %" PRIu64 " us late\n", i, cur, expect_names[change], cur - due);
+            counts.late++;
+        }
+    }
+    checkers[i].expect = change == EXPECT_RETRACT_OFF ? EXPECT_NONE : change + 1;
+}
+
+/** GPIO write hook, checks every change of every pin */
+static void check_outputs(void)
+{
+    counts.gpio_writes++;
+    const uint64_t cur = time_us_64();
+    vcd_sample(cur);
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        const bool extending = virtual_gpio_get_output(actuator_gpios[i][0]) == ACTUATOR_ACTIVE_LOGIC_LEVEL_EXTEND;
+        const bool retracting = virtual_gpio_get_output(actuator_gpios[i][1]) == ACTUATOR_ACTIVE_LOGIC_LEVEL_RETRACT;
+        if (extending && retracting)
+        {
+            fprintf(stderr, "Actuator %zu at %" PRIu64 " us: driven both ways\n", i, cur);
+            counts.both_ways++;
+        }
+        if (extending != checkers[i].extending)
+            check_change(i, extending ? EXPECT_EXTEND_ON : EXPECT_EXTEND_OFF, cur);
+        if (retracting != checkers[i].retracting)
+            check_change(i, retracting ? EXPECT_RETRACT_ON : EXPECT_RETRACT_OFF, cur);
+        checkers[i].extending = extending;
+        checkers[i].retracting = retracting;
+    }
+}
+
+static bool actuators_in_cycle()
+{
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        if (actuator_in_cycle(&actuators[i]))
+            return true;
+    return false;
+}
+
+/** Time (in microseconds since boot) of the next actuator phase change, capped at limit */
+static uint64_t actuators_next_deadline(uint64_t limit)
+{
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        /* actuator_poll() only switches once the edge has passed */
+        const uint64_t edge = actuator_next_edge(&actuators[i]);
+        if (edge != UINT64_MAX && edge + 1 < limit)
+            limit = edge + 1;
+    }
+    return limit;
+}
+
+/** Boot like main_core1(), every position is unknown so every actuator retracts fully */
+static void boot()
+{
+    struct actuator_config_t cinfo = {};
+    cinfo.time_travel = ACTUATOR_TRAVEL_TIME;
+    cinfo.time_rest = ACTUATOR_REST_TIME;
+    cinfo.logic_active_level_extend = ACTUATOR_ACTIVE_LOGIC_LEVEL_EXTEND;
+    cinfo.logic_active_level_retract = ACTUATOR_ACTIVE_LOGIC_LEVEL_RETRACT;
+    cinfo.time_stroke = opts.stroke;
+    cinfo.time_margin = ACTUATOR_POSITION_MARGIN;
+    cinfo.initial_position = -1;
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        /* The pins only get their inactive levels from actuator_init() */
+        checkers[i].extending = false;
+        checkers[i].retracting = false;
+        checkers[i].expect = EXPECT_RETRACT_ON;
+        checkers[i].due[EXPECT_RETRACT_ON] = time_us_64();
+        checkers[i].due[EXPECT_RETRACT_OFF] = time_us_64() + ACTUATOR_TRAVEL_TIME;
+        cinfo.gpio_extend = actuator_gpios[i][0];
+        cinfo.gpio_retract = actuator_gpios[i][1];
+        if (!actuator_init(&actuators[i], &cinfo))
+        {
+            fprintf(stderr, "Actuator %zu: Unable to initialize\n", i);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (!opts.alarm_latency)
+        actuator_poll_all();
+}
+
+/** Idle gap (in microseconds) before the next trigger of an actuator, counted from the end of its last cycle */
+static uint64_t next_trigger_time(const size_t i)
+{
+    /* Alarms only switch the outputs off at the end of the cycle once the latency has passed */
+    return actuators[i].timestamp_end_retract + 1 + opts.alarm_latency + random_next() % (2 * ACTUATOR_REST_TIME);
+}
+
+static void usage(const char* argv0)
+{
+    fprintf(stderr,
+        "Usage: %s [OPTIONS]\n"
+        "Check the output timing of the actuator code against its configuration\n"
+        "\n"
+        "  -s, --stroke US  Stroke time in microseconds (default: ACTUATOR_STROKE_TIME)\n"
+        "  -c, --cycles N   Number of cycles over all actuators (default: 1000000)\n"
+        "  -l, --slack US   Largest allowed lateness of an output change (default: 1)\n"
+        "  -r, --seed N     Random seed (default: 1)\n"
+        "  -a, --alarm-latency US\n"
+        "                   Only switch the outputs from timer alarms, which run US microseconds late\n"
+        "  -o, --vcd FILE   Write the pin levels to a VCD file\n",
+        argv0);
+}
+
+int main(int argc, char** argv)
+{
+    static const struct option long_options[] = {
+        { "stroke", required_argument, NULL, 's' },
+        { "cycles", required_argument, NULL, 'c' },
+        { "slack", required_argument, NULL, 'l' },
+        { "seed", required_argument, NULL, 'r' },
+        { "alarm-latency", required_argument, NULL, 'a' },
+        { "vcd", required_argument, NULL, 'o' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 },
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "s:c:l:r:a:o:h", long_options, NULL)) != -1)
+    {
+        switch (c)
+        {
+        case 's':
+            opts.stroke = strtoull(optarg, NULL, 0);
+            break;
+        case 'c':
+            opts.cycles = strtoul(optarg, NULL, 0);
+            break;
+        case 'l':
+            opts.slack = strtoull(optarg, NULL, 0);
+            break;
+        case 'r':
+            opts.seed = strtoull(optarg, NULL, 0);
+            break;
+        case 'a':
+            opts.alarm_latency = strtoull(optarg, NULL, 0);
+            break;
+        case 'o':
+            opts.vcd = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return c == 'h' ? 0 : 1;
+        }
+    }
+    if (!opts.stroke || opts.stroke > ACTUATOR_TRAVEL_TIME || !opts.seed)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (opts.vcd)
+    {
+        if (!vcd_open(opts.vcd, "actuators"))
+        {
+            fprintf(stderr, "Unable to create %s\n", opts.vcd);
+            return 1;
+        }
+        char name[32];
+        for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        {
+            snprintf(name, sizeof(name), "actuator%zu_extend", i);
+            vcd_add_gpio(actuator_gpios[i][0], name);
+            snprintf(name, sizeof(name), "actuator%zu_retract", i);
+            vcd_add_gpio(actuator_gpios[i][1], name);
+        }
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    virtual_gpio_set_write_hook(check_outputs);
+    virtual_clock_set_alarm_latency(opts.alarm_latency);
+    boot();
+
+    uint64_t next_trigger[NUM_ACTUATORS];
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        next_trigger[i] = next_trigger_time(i);
+
+    while (counts.cycles < opts.cycles)
+    {
+        const uint64_t cur = time_us_64();
+        uint64_t next = UINT64_MAX;
+        for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        {
+            if (!actuator_in_cycle(&actuators[i]) && next_trigger[i] <= cur && counts.cycles < opts.cycles)
+            {
+                expect_cycle(i, cur);
+                actuator_trigger(&actuators[i]);
+                counts.cycles++;
+                next_trigger[i] = next_trigger_time(i);
+            }
+            if (next_trigger[i] < next)
+                next = next_trigger[i];
+        }
+        virtual_clock_advance_to(actuators_next_deadline(next));
+        if (!opts.alarm_latency)
+            actuator_poll_all();
+    }
+    while (actuators_in_cycle())
+    {
+        virtual_clock_advance_to(actuators_next_deadline(UINT64_MAX));
+        if (!opts.alarm_latency)
+            actuator_poll_all();
+    }
+    /* Let the alarm of the last edge fire */
+    virtual_clock_advance_to(time_us_64() + opts.alarm_latency);
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    vcd_close();
+    const double elapsed = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        if (checkers[i].expect != EXPECT_NONE)
+        {
+            fprintf(stderr, "Actuator %zu: still expecting %s at the end\n", i, expect_names[checkers[i].expect]);
+            counts.unexpected++;
+        }
+    }
+
+    printf("%u cycles, %" PRIu64 " output changes, %" PRIu64 " GPIO writes in %.3f s (%.0f cycles/s), %.1f days simulated\n", counts.cycles,
+        counts.edges, counts.gpio_writes, elapsed, counts.cycles / (elapsed > 0.0 ? elapsed : 1.0),
+        (double)time_us_64() / 1e6 / 86400.0);
+    printf("Max lateness: %" PRIu64 " us (slack %" PRIu64 " us): %u early, %u late, %u unexpected, %u driven both ways\n", counts.max_lateness,
+        opts.slack + opts.alarm_latency, counts.early, counts.late, counts.unexpected, counts.both_ways);
+
+    return counts.early || counts.late || counts.unexpected || counts.both_ways ? 1 : 0;
+}
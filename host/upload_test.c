@@ -0,0 +1,264 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Drive the schedule upload server through a simulated client, flash, and clock
+ *
+ * Runs schedule_upload.c against the stand-ins for lwIP (virtual_net.c) and flash (virtual_flash.c), and checks that a
+ * good image goes live, and that every kind of bad upload is refused without touching the live slot.
+ *
+ * Exits with a non-zero status if any check fails.
+ */
+#include "crc32.h"
+#include "flash_guard.h"
+#include "schedule_partition.h"
+#include "schedule_upload.h"
+#include "virtual_clock.h"
+
+#include "config.h"
+
+#include "schedule_level_1_packed.h"
+#include "schedule_level_2_packed.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "hardware/regs/addressmap.h"
+#include "lwip/tcp.h"
+#include "pico/time.h"
+
+/** "PLSU" */
+#define UPLOAD_MAGIC 0x55534C50u
+
+/** Size (in bytes) of the magic and image size sent before the image */
+#define PREAMBLE_SIZE 8
+
+/** Segment size of the simulated client */
+#define SEGMENT_SIZE 536
+
+static int failures = 0;
+
+#define CHECK(cond, fmt, ...)                                                   \
+    do                                                                          \
+    {                                                                           \
+        if (!(cond))                                                            \
+        {                                                                       \
+            printf("FAIL %s:%d: " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__); \
+            failures++;                                                         \
+        }                                                                       \
+    } while (0)
+
+static const uint8_t* partition(void) { return (const uint8_t*)(XIP_BASE + SCHEDULE_PARTITION_OFFSET); }
+
+static int active_slot(void) { return schedule_partition_find_active(partition(), SCHEDULE_PARTITION_SLOT_SIZE, SCHEDULE_PARTITION_NUM_SLOTS, NULL); }
+
+static schedule_partition_header_t image_header(const uint8_t* const image)
+{
+    schedule_partition_header_t header;
+    memcpy(&header, image, sizeof(header));
+    return header;
+}
+
+/** Recompute the CRC, as a careless (or malicious) uploader would */
+static void image_seal(uint8_t* const image)
+{
+    schedule_partition_header_t header = image_header(image);
+    header.payload_crc = crc32_update(0, image + sizeof(header), header.payload_size);
+    memcpy(image, &header, sizeof(header));
+}
+
+static void image_set_entry(uint8_t* const image, const uint32_t i, const schedule_partition_entry_t* const entry)
+{
+    memcpy(image + sizeof(schedule_partition_header_t) + i * sizeof(*entry), entry, sizeof(*entry));
+}
+
+static schedule_partition_entry_t image_get_entry(const uint8_t* const image, const uint32_t i)
+{
+    schedule_partition_entry_t entry;
+    memcpy(&entry, image + sizeof(schedule_partition_header_t) + i * sizeof(entry), sizeof(entry));
+    return entry;
+}
+
+/** Build a slot image like make_schedule_partition.py does, returns its size */
+static uint32_t image_build(uint8_t* const image, const schedule_packed_t* const* const schedules, const uint32_t num_schedules)
+{
+    const schedule_partition_header_t header = { SCHEDULE_PARTITION_MAGIC, SCHEDULE_PARTITION_VERSION, 0, 0, num_schedules, 0, { 0, 0 } };
+    uint32_t offset = sizeof(header) + num_schedules * sizeof(schedule_partition_entry_t);
+    for (uint32_t i = 0; i < num_schedules; i++)
+    {
+        const schedule_packed_t* const s = schedules[i];
+        const schedule_partition_entry_t entry = { s->epoch, s->resolution, s->num_entries, offset, s->size };
+        image_set_entry(image, i, &entry);
+        memcpy(image + offset, s->data, s->size);
+        offset += s->size;
+    }
+    memcpy(image, &header, sizeof(header));
+    schedule_partition_header_t h = image_header(image);
+    h.payload_size = offset - sizeof(header);
+    memcpy(image, &h, sizeof(h));
+    image_seal(image);
+    return offset;
+}
+
+/** Run the server until it closes the connection */
+static void upload_run(struct tcp_pcb* const pcb)
+{
+    for (int i = 0; i < 1000000 && !pcb->closed; i++)
+    {
+        virtual_clock_advance_to(time_us_64() + 1000);
+        /* Core 1 has nothing due, so flash may be written at any time */
+        flash_guard_core1_next_event_ms = time_us_64() / 1000 + 60 * 1000;
+        schedule_upload_poll();
+    }
+}
+
+/**
+ * Upload an image as upload_schedule.py does
+ *
+ * @param magic Magic of the preamble
+ * @param image Image to send
+ * @param size Size of the image, as announced in the preamble
+ * @param send Bytes of the stream (preamble and image) to send before the client closes the connection
+ *
+ * @returns Reply of the server
+ */
+static const char* upload(const uint32_t magic, const uint8_t* const image, const uint32_t size, const uint32_t send)
+{
+    static uint8_t stream[PREAMBLE_SIZE + SCHEDULE_PARTITION_SLOT_SIZE];
+    static char reply[sizeof(((struct tcp_pcb*)0)->reply)];
+    struct tcp_pcb* const pcb = virtual_net_connect();
+    if (!pcb)
+        return "(connection refused)";
+
+    memcpy(stream, &magic, sizeof(magic));
+    memcpy(stream + sizeof(magic), &size, sizeof(size));
+    memcpy(stream + PREAMBLE_SIZE, image, size);
+    for (uint32_t offset = 0; offset < send && !pcb->closed; offset += SEGMENT_SIZE)
+    {
+        virtual_net_send(pcb, stream + offset, send - offset < SEGMENT_SIZE ? send - offset : SEGMENT_SIZE);
+        schedule_upload_poll();
+    }
+    if (send < PREAMBLE_SIZE + size)
+        virtual_net_close(pcb);
+    upload_run(pcb);
+
+    CHECK(pcb->closed, "Server did not close the connection");
+    /* Everything consumed must have been handed back, or the TCP window stays shut */
+    CHECK(strncmp(pcb->reply, "OK", 2) != 0 || pcb->recved == send, "Received window not reopened (%u of %u bytes)", pcb->recved, send);
+    snprintf(reply, sizeof(reply), "%s", pcb->reply);
+    /* Drop the newline */
+    reply[strcspn(reply, "\n")] = 0;
+    return reply;
+}
+
+static uint8_t image[SCHEDULE_PARTITION_SLOT_SIZE];
+static uint8_t live[SCHEDULE_PARTITION_SLOT_SIZE];
+
+/** Upload an image that must be refused, and check that the live slot and generation are as they were */
+static void upload_bad(const char* const name, const uint32_t magic, const uint32_t size, const uint32_t send, const char* const expect)
+{
+    const uint32_t generation = schedule_upload_generation;
+    const char* const reply = upload(magic, image, size, send);
+    printf("%-32s %s\n", name, reply);
+    CHECK(strncmp(reply, expect, strlen(expect)) == 0, "%s: Expected \"%s...\"", name, expect);
+    CHECK(schedule_upload_generation == generation, "%s: Generation changed", name);
+    CHECK(active_slot() == 0, "%s: Active slot is %d", name, active_slot());
+    CHECK(memcmp(partition(), live, sizeof(live)) == 0, "%s: Live slot was modified", name);
+}
+
+int main()
+{
+    virtual_flash_reset();
+    schedule_upload_init();
+    /* Core 1 has loaded its schedules */
+    schedule_upload_generation_applied = schedule_upload_generation;
+
+    const schedule_packed_t* const schedules[] = { &schedule_level_1_packed, &schedule_level_2_packed };
+    const uint32_t size = image_build(image, schedules, 2);
+
+    /* Good image into an empty partition */
+    const char* reply = upload(UPLOAD_MAGIC, image, size, PREAMBLE_SIZE + size);
+    printf("%-32s %s\n", "good image", reply);
+    CHECK(strcmp(reply, "OK 0 1") == 0, "Good image not accepted");
+    CHECK(active_slot() == 0, "Active slot is %d", active_slot());
+    CHECK(memcmp(partition() + sizeof(schedule_partition_header_t), image + sizeof(schedule_partition_header_t), size - sizeof(schedule_partition_header_t)) == 0,
+        "Slot does not hold the image");
+    schedule_upload_generation_applied = schedule_upload_generation;
+    memcpy(live, partition(), sizeof(live));
+
+    /* Refused before anything is written */
+    upload_bad("bad magic", ~UPLOAD_MAGIC, size, PREAMBLE_SIZE + size, "ERR bad magic");
+    upload_bad("truncated stream", UPLOAD_MAGIC, size, PREAMBLE_SIZE + size / 2, "ERR connection closed");
+    upload_bad("truncated preamble", UPLOAD_MAGIC, size, PREAMBLE_SIZE / 2, "ERR connection closed in the preamble");
+    upload_bad("closed after preamble", UPLOAD_MAGIC, size, PREAMBLE_SIZE, "ERR connection closed");
+
+    image[sizeof(schedule_partition_header_t) + 100] ^= 0x01;
+    upload_bad("bad CRC", UPLOAD_MAGIC, size, PREAMBLE_SIZE + size, "ERR CRC mismatch");
+    image_build(image, schedules, 2);
+
+    image[0] ^= 0x01;
+    upload_bad("bad image magic", UPLOAD_MAGIC, size, PREAMBLE_SIZE + size, "ERR not a schedule partition image");
+    image_build(image, schedules, 2);
+
+    /* Refused by schedule_partition_validate(), even with a matching CRC */
+    schedule_partition_entry_t entry = image_get_entry(image, 1);
+    /* The first byte of the header magic decodes as one entry */
+    entry.offset = 0;
+    entry.size = 1;
+    entry.num_entries = 1;
+    image_set_entry(image, 1, &entry);
+    image_seal(image);
+    upload_bad("descriptor points at header", UPLOAD_MAGIC, size, PREAMBLE_SIZE + size, "ERR slot 1 failed validation");
+    image_build(image, schedules, 2);
+
+    entry = image_get_entry(image, 1);
+    entry.resolution = 1u << 29;
+    image_set_entry(image, 1, &entry);
+    image_seal(image);
+    upload_bad("timestamps past 2^30", UPLOAD_MAGIC, size, PREAMBLE_SIZE + size, "ERR slot 1 failed validation");
+    image_build(image, schedules, 2);
+
+    /* Second entry at the same time as the first */
+    static const uint8_t repeated[] = { 0x06, 0x00 };
+    const schedule_packed_t repeated_packed = { schedule_level_1_packed.epoch, 60, 2, sizeof(repeated), repeated };
+    const schedule_packed_t* const unsorted[] = { &schedule_level_1_packed, &repeated_packed };
+    const uint32_t unsorted_size = image_build(image, unsorted, 2);
+    upload_bad("timestamps not increasing", UPLOAD_MAGIC, unsorted_size, PREAMBLE_SIZE + unsorted_size, "ERR slot 1 failed validation");
+
+    /* The partition still takes a good image afterwards */
+    image_build(image, schedules, 2);
+    reply = upload(UPLOAD_MAGIC, image, size, PREAMBLE_SIZE + size);
+    printf("%-32s %s\n", "good image after failures", reply);
+    CHECK(strcmp(reply, "OK 1 2") == 0, "Good image not accepted after failures");
+    CHECK(active_slot() == 1, "Active slot is %d", active_slot());
+
+    printf("%d failures, %u flash operations\n", failures, virtual_flash_get_operations());
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
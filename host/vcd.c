@@ -0,0 +1,134 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Value change dump (VCD) writer for the outputs of the virtual GPIO layer (Implementation)
+ */
+#include "vcd.h"
+
+#include "hardware/gpio.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+static FILE* file;
+static const char* scope_name;
+static bool header_written;
+/** Timestamp of the last "#" line, UINT64_MAX before the first */
+static uint64_t last_timestamp;
+
+static struct
+{
+    uint gpio;
+    char name[32];
+    bool level;
+} signals[VCD_MAX_SIGNALS];
+static size_t num_signals;
+
+/** Identifier code of a signal, printable ASCII from '!' */
+static char signal_id(const size_t i) { return (char)('!' + i); }
+
+bool vcd_open(const char* path, const char* scope)
+{
+    vcd_close();
+    file = fopen(path, "w");
+    if (!file)
+        return false;
+    /* Millions of changes get written, let stdio batch them */
+    setvbuf(file, NULL, _IOFBF, 1 << 20);
+    scope_name = scope;
+    header_written = false;
+    last_timestamp = UINT64_MAX;
+    num_signals = 0;
+    return true;
+}
+
+void vcd_add_gpio(uint gpio, const char* name)
+{
+    if (!file || header_written || num_signals >= VCD_MAX_SIGNALS)
+        return;
+    signals[num_signals].gpio = gpio;
+    snprintf(signals[num_signals].name, sizeof(signals[num_signals].name), "%s", name);
+    num_signals++;
+}
+
+static void write_header(const uint64_t timestamp)
+{
+    fprintf(file, "$timescale 1us $end\n");
+    fprintf(file, "$scope module %s $end\n", scope_name);
+    for (size_t i = 0; i < num_signals; i++)
+        fprintf(file, "$var wire 1 %c %s $end\n", signal_id(i), signals[i].name);
+    fprintf(file, "$upscope $end\n$enddefinitions $end\n");
+
+    fprintf(file, "#%" PRIu64 "\n$dumpvars\n", timestamp);
+    for (size_t i = 0; i < num_signals; i++)
+    {
+        signals[i].level = virtual_gpio_get_output(signals[i].gpio);
+        fprintf(file, "%d%c\n", signals[i].level, signal_id(i));
+    }
+    fprintf(file, "$end\n");
+    last_timestamp = timestamp;
+    header_written = true;
+}
+
+void vcd_sample(uint64_t timestamp)
+{
+    if (!file)
+        return;
+    if (!header_written)
+    {
+        write_header(timestamp);
+        return;
+    }
+    for (size_t i = 0; i < num_signals; i++)
+    {
+        const bool level = virtual_gpio_get_output(signals[i].gpio);
+        if (level == signals[i].level)
+            continue;
+        if (timestamp != last_timestamp)
+        {
+            fprintf(file, "#%" PRIu64 "\n", timestamp);
+            last_timestamp = timestamp;
+        }
+        fprintf(file, "%d%c\n", level, signal_id(i));
+        signals[i].level = level;
+    }
+}
+
+bool vcd_is_open(void) { return file != NULL; }
+
+void vcd_close(void)
+{
+    if (!file)
+        return;
+    /* Mark the end, so that the last levels are drawn up to it */
+    if (header_written)
+        fprintf(file, "#%" PRIu64 "\n", last_timestamp + 1);
+    fclose(file);
+    file = NULL;
+}
@@ -0,0 +1,76 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Value change dump (VCD) writer for the outputs of the virtual GPIO layer
+ *
+ * Records the level of a set of gpios on the virtual clock, for viewing in a waveform viewer (eg. GTKWave)
+ */
+#pragma once
+
+#include "pico.h"
+
+/** Maximum number of gpios in one file */
+#define VCD_MAX_SIGNALS 64
+
+/**
+ * Create a VCD file, with a timescale of 1 microsecond
+ *
+ * @param path File to write
+ * @param scope Name of the module the signals are listed under
+ *
+ * @returns True on success, False if the file could not be created
+ */
+bool vcd_open(const char* path, const char* scope);
+
+/**
+ * Add the output level of a gpio as a signal, must be called before the first vcd_sample()
+ *
+ * @param gpio GPIO to record
+ * @param name Signal name (Copied)
+ */
+void vcd_add_gpio(uint gpio, const char* name);
+
+/**
+ * Record the signals that changed since the last sample
+ *
+ * The first call writes the header and the initial level of every signal
+ *
+ * @param timestamp Time (in microseconds), must not go backwards
+ */
+void vcd_sample(uint64_t timestamp);
+
+/**
+ * Check if a file is open
+ */
+bool vcd_is_open(void);
+
+/**
+ * Finish and close the file
+ */
+void vcd_close(void);
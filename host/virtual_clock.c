@@ -0,0 +1,161 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Virtual clock that replaces the hardware timer and unix_time.c on the host (Implementation)
+ */
+#include "virtual_clock.h"
+
+#include "pico/time.h"
+
+#include <string.h>
+
+/** Value of time_us_64() */
+static uint64_t us_since_boot = 0;
+/** Unix time (in microseconds) at boot */
+static microseconds_t unix_time_at_boot = 0;
+static microseconds_t last_sync = 0;
+
+/** Delay (in microseconds) between the target of an alarm and its callback */
+static uint64_t alarm_latency = 0;
+
+struct virtual_alarm_t
+{
+    /** 0 if the slot is free */
+    alarm_id_t id;
+    uint64_t target;
+    alarm_callback_t callback;
+    void* user_data;
+};
+
+struct alarm_pool
+{
+    struct virtual_alarm_t alarms[PICO_TIME_DEFAULT_ALARM_POOL_MAX_TIMERS];
+    alarm_id_t last_id;
+};
+
+static alarm_pool_t alarm_pool;
+
+uint64_t time_us_64(void) { return us_since_boot; }
+
+void virtual_clock_reboot(void)
+{
+    unix_time_at_boot += us_since_boot;
+    us_since_boot = 0;
+    /* The timer is reset along with everything else */
+    memset(&alarm_pool, 0, sizeof(alarm_pool));
+}
+
+/** @returns Alarm with the earliest target, or NULL if there are none */
+static struct virtual_alarm_t* virtual_clock_next_alarm(void)
+{
+    struct virtual_alarm_t* next = NULL;
+    for (size_t i = 0; i < PICO_TIME_DEFAULT_ALARM_POOL_MAX_TIMERS; i++)
+    {
+        struct virtual_alarm_t* const a = &alarm_pool.alarms[i];
+        if (a->id && (!next || a->target < next->target))
+            next = a;
+    }
+    return next;
+}
+
+void virtual_clock_advance_to(const uint64_t us)
+{
+    struct virtual_alarm_t* a;
+    while ((a = virtual_clock_next_alarm()) && a->target + alarm_latency <= us)
+    {
+        if (a->target + alarm_latency > us_since_boot)
+            us_since_boot = a->target + alarm_latency;
+        const alarm_id_t id = a->id;
+        const int64_t ret = a->callback(id, a->user_data);
+        /* The callback may have cancelled its own alarm */
+        if (a->id != id)
+            continue;
+        /* Same as the SDK: negative values are relative to the previous target, positive ones to when the callback returned */
+        if (ret < 0)
+            a->target += (uint64_t)-ret;
+        else if (ret > 0)
+            a->target = us_since_boot + (uint64_t)ret;
+        else
+            a->id = 0;
+    }
+
+    if (us > us_since_boot)
+        us_since_boot = us;
+}
+
+void virtual_clock_set_alarm_latency(const uint64_t us) { alarm_latency = us; }
+
+alarm_pool_t* alarm_pool_create_with_unused_hardware_alarm(const uint max_timers)
+{
+    (void)max_timers;
+    return &alarm_pool;
+}
+
+alarm_id_t alarm_pool_add_alarm_at(alarm_pool_t* pool, absolute_time_t time, alarm_callback_t callback, void* user_data, bool fire_if_past)
+{
+    if (time <= us_since_boot && !fire_if_past)
+        return 0;
+    for (size_t i = 0; i < PICO_TIME_DEFAULT_ALARM_POOL_MAX_TIMERS; i++)
+    {
+        struct virtual_alarm_t* const a = &pool->alarms[i];
+        if (a->id)
+            continue;
+        pool->last_id = pool->last_id == INT32_MAX ? 1 : pool->last_id + 1;
+        *a = (struct virtual_alarm_t) { pool->last_id, time, callback, user_data };
+        return a->id;
+    }
+    return -1;
+}
+
+bool alarm_pool_cancel_alarm(alarm_pool_t* pool, alarm_id_t alarm_id)
+{
+    if (alarm_id <= 0)
+        return false;
+    for (size_t i = 0; i < PICO_TIME_DEFAULT_ALARM_POOL_MAX_TIMERS; i++)
+    {
+        if (pool->alarms[i].id == alarm_id)
+        {
+            pool->alarms[i].id = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+microseconds_t get_unix_time() { return unix_time_at_boot + (microseconds_t)us_since_boot; }
+
+microseconds_t unix_time_get_last_sync() { return last_sync; }
+
+void set_unix_time(const microseconds_t microseconds_since_1970)
+{
+    unix_time_at_boot = microseconds_since_1970 - (microseconds_t)us_since_boot;
+    last_sync = microseconds_since_1970;
+}
+
+void init_unix_time() { }
@@ -0,0 +1,56 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Virtual clock that replaces the hardware timer and unix_time.c on the host
+ *
+ * time_us_64() only moves when told to, so the control logic can be fast-forwarded from one event to the next.
+ * Alarms from pico/time.h fire as the clock moves past them.
+ */
+#pragma once
+
+#include "unix_time.h"
+
+#include <stdint.h>
+
+/**
+ * Reboot the virtual clock: time_us_64() restarts at 0 while unix time carries on
+ */
+void virtual_clock_reboot(void);
+
+/**
+ * Move time_us_64() forward to us (Does nothing if us is in the past)
+ *
+ * Every alarm due by then fires in order, with time_us_64() at its target plus the alarm latency
+ */
+void virtual_clock_advance_to(const uint64_t us);
+
+/**
+ * Set the delay (in microseconds) between the target of an alarm and its callback running, like IRQ latency
+ */
+void virtual_clock_set_alarm_latency(const uint64_t us);
@@ -0,0 +1,79 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Host stand-in for the pico-sdk hardware/flash.h (Implementation)
+ */
+#include "hardware/flash.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint8_t* virtual_flash = NULL;
+
+static uint32_t operations = 0;
+
+/* Catch what the device would silently get wrong */
+static void virtual_flash_check(const uint32_t flash_offs, const size_t count, const uint32_t align)
+{
+    if (flash_offs % align || count % align || flash_offs + count > PICO_FLASH_SIZE_BYTES)
+    {
+        fprintf(stderr, "virtual_flash: Bad range 0x%08x + 0x%zx (alignment %u)\n", flash_offs, count, align);
+        abort();
+    }
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count)
+{
+    virtual_flash_check(flash_offs, count, FLASH_SECTOR_SIZE);
+    memset(virtual_flash + flash_offs, 0xFF, count);
+    operations++;
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t* data, size_t count)
+{
+    virtual_flash_check(flash_offs, count, FLASH_PAGE_SIZE);
+    for (size_t i = 0; i < count; i++)
+        virtual_flash[flash_offs + i] &= data[i];
+    operations++;
+}
+
+void virtual_flash_reset(void)
+{
+    /* On the heap, so that it lies above __flash_binary_end (below) */
+    if (!virtual_flash)
+        virtual_flash = malloc(PICO_FLASH_SIZE_BYTES);
+    memset(virtual_flash, 0xFF, PICO_FLASH_SIZE_BYTES);
+    operations = 0;
+}
+
+uint32_t virtual_flash_get_operations(void) { return operations; }
+
+/* Definition in the pico-sdk linker script, the firmware ends below any heap address */
+char __flash_binary_end;
@@ -0,0 +1,101 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Host stand-in for the pico-sdk hardware/gpio.h (Implementation)
+ */
+#include "hardware/gpio.h"
+
+static struct
+{
+    bool out;
+    bool level;
+    bool pull_up;
+    bool forced;
+    bool forced_level;
+} gpios[NUM_BANK0_GPIOS];
+
+static void (*write_hook)(void);
+
+void gpio_init(uint gpio)
+{
+    gpios[gpio].out = false;
+    gpios[gpio].level = false;
+    gpios[gpio].pull_up = false;
+}
+
+void gpio_set_dir(uint gpio, bool out) { gpios[gpio].out = out; }
+
+void gpio_put(uint gpio, bool value)
+{
+    gpios[gpio].level = value;
+    if (write_hook)
+        write_hook();
+}
+
+void gpio_put_masked64(uint64_t mask, uint64_t value)
+{
+    for (uint i = 0; i < NUM_BANK0_GPIOS; i++)
+        if (mask & (1ull << i))
+            gpios[i].level = (value >> i) & 1;
+    if (write_hook)
+        write_hook();
+}
+
+bool gpio_get(uint gpio)
+{
+    if (gpios[gpio].out)
+        return gpios[gpio].level;
+    if (gpios[gpio].forced)
+        return gpios[gpio].forced_level;
+    return gpios[gpio].pull_up;
+}
+
+void gpio_pull_up(uint gpio) { gpios[gpio].pull_up = true; }
+
+void gpio_pull_down(uint gpio) { gpios[gpio].pull_up = false; }
+
+void virtual_gpio_set_input(uint gpio, bool value)
+{
+    gpios[gpio].forced = true;
+    gpios[gpio].forced_level = value;
+}
+
+bool virtual_gpio_get_output(uint gpio) { return gpios[gpio].level; }
+
+void virtual_gpio_set_write_hook(void (*hook)(void)) { write_hook = hook; }
+
+void virtual_gpio_reset(void)
+{
+    for (uint i = 0; i < NUM_BANK0_GPIOS; i++)
+    {
+        gpios[i].out = false;
+        gpios[i].level = false;
+        gpios[i].pull_up = false;
+    }
+}
@@ -0,0 +1,156 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Host stand-in for the lwIP raw TCP API (Implementation)
+ */
+#include "lwip/tcp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Every pcb lives until exit, so that the caller can inspect a connection after it was closed */
+static struct tcp_pcb* listener = NULL;
+
+static struct tcp_pcb* pcb_new(void) { return calloc(1, sizeof(struct tcp_pcb)); }
+
+struct tcp_pcb* tcp_new_ip_type(uint8_t type)
+{
+    (void)type;
+    return pcb_new();
+}
+
+err_t tcp_bind(struct tcp_pcb* pcb, const ip_addr_t* ipaddr, uint16_t port)
+{
+    (void)pcb, (void)ipaddr, (void)port;
+    return ERR_OK;
+}
+
+struct tcp_pcb* tcp_listen_with_backlog(struct tcp_pcb* pcb, uint8_t backlog)
+{
+    (void)backlog;
+    listener = pcb;
+    return pcb;
+}
+
+void tcp_accept(struct tcp_pcb* pcb, tcp_accept_fn accept) { pcb->accept = accept; }
+void tcp_arg(struct tcp_pcb* pcb, void* arg) { pcb->arg = arg; }
+void tcp_recv(struct tcp_pcb* pcb, tcp_recv_fn recv) { pcb->recv = recv; }
+void tcp_err(struct tcp_pcb* pcb, tcp_err_fn err) { pcb->errf = err; }
+void tcp_recved(struct tcp_pcb* pcb, uint16_t len) { pcb->recved += len; }
+
+err_t tcp_write(struct tcp_pcb* pcb, const void* dataptr, uint16_t len, uint8_t apiflags)
+{
+    (void)apiflags;
+    if (pcb->reply_len + len >= sizeof(pcb->reply))
+        return ERR_VAL;
+    memcpy(pcb->reply + pcb->reply_len, dataptr, len);
+    pcb->reply_len += len;
+    pcb->reply[pcb->reply_len] = 0;
+    return ERR_OK;
+}
+
+err_t tcp_output(struct tcp_pcb* pcb)
+{
+    (void)pcb;
+    return ERR_OK;
+}
+
+err_t tcp_close(struct tcp_pcb* pcb)
+{
+    pcb->closed = true;
+    return ERR_OK;
+}
+
+void tcp_abort(struct tcp_pcb* pcb)
+{
+    pcb->closed = true;
+    if (pcb->errf)
+        pcb->errf(pcb->arg, ERR_ABRT);
+}
+
+void pbuf_cat(struct pbuf* head, struct pbuf* tail)
+{
+    head->payload = realloc(head->payload, head->tot_len + tail->tot_len);
+    memcpy((uint8_t*)head->payload + head->tot_len, tail->payload, tail->tot_len);
+    head->tot_len += tail->tot_len;
+    head->len = head->tot_len;
+    pbuf_free(tail);
+}
+
+uint8_t pbuf_free(struct pbuf* p)
+{
+    free(p->payload);
+    free(p);
+    return 1;
+}
+
+uint16_t pbuf_copy_partial(const struct pbuf* p, void* dataptr, uint16_t len, uint16_t offset)
+{
+    if (offset >= p->tot_len)
+        return 0;
+    if (len > p->tot_len - offset)
+        len = p->tot_len - offset;
+    memcpy(dataptr, (const uint8_t*)p->payload + offset, len);
+    return len;
+}
+
+const char* ipaddr_ntoa(const ip_addr_t* addr)
+{
+    (void)addr;
+    return "virtual";
+}
+
+struct tcp_pcb* virtual_net_connect(void)
+{
+    if (!listener || !listener->accept)
+        return NULL;
+    struct tcp_pcb* pcb = pcb_new();
+    if (listener->accept(listener->arg, pcb, ERR_OK) != ERR_OK)
+        return NULL;
+    return pcb;
+}
+
+void virtual_net_send(struct tcp_pcb* pcb, const void* data, uint16_t len)
+{
+    if (pcb->closed || !pcb->recv)
+        return;
+    struct pbuf* p = calloc(1, sizeof(*p));
+    p->payload = malloc(len);
+    memcpy(p->payload, data, len);
+    p->tot_len = len;
+    p->len = len;
+    pcb->recv(pcb->arg, pcb, p, ERR_OK);
+}
+
+void virtual_net_close(struct tcp_pcb* pcb)
+{
+    if (!pcb->closed && pcb->recv)
+        pcb->recv(pcb->arg, pcb, NULL, ERR_OK);
+}
@@ -0,0 +1,110 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief High resolution journal of relay changes and control events (Implementation)
+ */
+#include "journal.h"
+
+#include "config.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "hardware/sync.h"
+#include "pico/time.h"
+
+static_assert(JOURNAL_SIZE && (JOURNAL_SIZE & (JOURNAL_SIZE - 1)) == 0, "JOURNAL_SIZE must be a power of 2");
+
+struct journal_t
+{
+    uint32_t magic;
+    /** Sequence number of the next entry, never 0 */
+    volatile uint32_t head;
+    struct journal_entry_t entries[JOURNAL_SIZE];
+};
+static struct journal_t __uninitialized_ram(journal);
+
+/** Unix time minus time since boot (in microseconds), only touched by core 1 with interrupts disabled */
+static microseconds_t unix_offset;
+
+void journal_init(void)
+{
+    uint32_t kept = 0;
+    if (journal.magic != JOURNAL_MAGIC || journal.head == 0)
+    {
+        memset(&journal, 0, sizeof(journal));
+        journal.magic = JOURNAL_MAGIC;
+        journal.head = 1;
+    }
+    else
+        kept = journal.head - 1 < JOURNAL_SIZE ? journal.head - 1 : JOURNAL_SIZE;
+    journal_sync_unix_time();
+    journal_record(JOURNAL_BOOT, 0, 0, kept, time_us_64());
+}
+
+void journal_sync_unix_time(void)
+{
+    const microseconds_t offset = get_unix_time() - (microseconds_t)time_us_64();
+    const uint32_t irq = save_and_disable_interrupts();
+    unix_offset = offset;
+    restore_interrupts(irq);
+}
+
+void journal_record(const enum journal_event_t event, const uint8_t id, const uint16_t arg, const uint32_t value, const uint64_t timestamp)
+{
+    const uint32_t irq = save_and_disable_interrupts();
+    const uint32_t sequence = journal.head;
+    journal.head = sequence + 1 ? sequence + 1 : 1;
+
+    struct journal_entry_t* const e = &journal.entries[sequence & (JOURNAL_SIZE - 1)];
+    e->sequence = 0;
+    __dmb();
+    e->event = event;
+    e->id = id;
+    e->arg = arg;
+    e->value = value;
+    e->timestamp = timestamp;
+    e->unix_time = (microseconds_t)timestamp + unix_offset;
+    __dmb();
+    e->sequence = sequence;
+    restore_interrupts(irq);
+}
+
+uint32_t journal_get_head(void) { return journal.head; }
+
+bool journal_read(const uint32_t sequence, struct journal_entry_t* const out)
+{
+    const volatile struct journal_entry_t* const e = &journal.entries[sequence & (JOURNAL_SIZE - 1)];
+    if (!sequence || e->sequence != sequence)
+        return false;
+    __dmb();
+    memcpy(out, (const void*)e, sizeof(*out));
+    __dmb();
+    return e->sequence == sequence && out->sequence == sequence;
+}
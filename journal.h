@@ -0,0 +1,123 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief High resolution journal of relay changes and control events
+ *
+ * A fixed-size ring buffer in RAM of every actuator phase change (ie. relay change), actuator trigger, and schedule
+ * region, each with the time since boot and the unix time (in microseconds) at which it happened, for working out what
+ * the relays did after the fact. Written from core 1 (including its timer alarms), read from any core.
+ *
+ * journal_record() only disables interrupts for the handful of stores into the next slot, and nothing is recorded by
+ * actuator_poll() unless an output actually changes.
+ *
+ * Readers don't take a lock: every entry carries its sequence number, which the writer clears before and sets after
+ * filling in the rest, so a reader that finds the same sequence number before and after its copy got a consistent entry.
+ * Entries overwritten in the meantime are skipped.
+ *
+ * The journal lives in RAM that is not cleared on reset, so the entries leading up to a watchdog reboot are kept.
+ */
+#pragma once
+
+#include "unix_time.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** "PLSJ" */
+#define JOURNAL_MAGIC 0x4A534C50u
+
+enum journal_event_t
+{
+    /** Core 1 started, journal_entry_t::value is the number of entries kept from before the reset */
+    JOURNAL_BOOT,
+    /** Outputs of an actuator changed, id is the extend gpio, arg the new phase (0: Idle, 1: Extending, 2: Retracting), and value the lateness (in microseconds) */
+    JOURNAL_ACTUATOR_PHASE,
+    /** Extend-retract cycle triggered, id is the extend gpio, and value the extend time (in microseconds) */
+    JOURNAL_ACTUATOR_TRIGGER,
+    /** A zone entered a schedule region, id is the zone index, arg the state (bit 1 set if held off), and value the region start (unix time in seconds) */
+    JOURNAL_ZONE_REGION,
+    /** A zone triggered an actuator, id is the zone index, and arg the state */
+    JOURNAL_ZONE_TRIGGER,
+    /** A zone resumed its state on boot, id is the zone index, and arg the state */
+    JOURNAL_ZONE_RESUME,
+};
+
+struct journal_entry_t
+{
+    /** Sequence number, 0 while the entry is being written */
+    uint32_t sequence;
+    uint8_t event; ///< One of journal_event_t
+    uint8_t id;
+    uint16_t arg;
+    uint32_t value;
+    uint64_t timestamp; ///< Time (in microseconds since the boot the entry was recorded in)
+    microseconds_t unix_time; ///< Unix time (in microseconds), as of the last journal_sync_unix_time()
+};
+
+/**
+ * Initialize the journal, keeping the entries from before a watchdog reboot, and record @ref JOURNAL_BOOT
+ *
+ * Must be called on core 1 before anything is recorded
+ */
+void journal_init(void);
+
+/**
+ * Update the unix time offset used for new entries
+ *
+ * Must be called on core 1, unix time read in interrupt context would have to take the lock of unix_time.c
+ */
+void journal_sync_unix_time(void);
+
+/**
+ * Record an event (Core 1 only, safe from interrupts)
+ *
+ * @param event One of journal_event_t
+ * @param id Actuator or zone the event is about
+ * @param arg Event specific
+ * @param value Event specific
+ * @param timestamp Time (in microseconds since boot) of the event
+ */
+void journal_record(const enum journal_event_t event, const uint8_t id, const uint16_t arg, const uint32_t value, const uint64_t timestamp);
+
+/**
+ * Get the sequence number the next entry will have
+ *
+ * The journal holds (at most) the @ref JOURNAL_SIZE entries before it
+ */
+uint32_t journal_get_head(void);
+
+/**
+ * Copy an entry out of the journal
+ *
+ * @param sequence Sequence number of the entry
+ * @param out Output entry
+ *
+ * @returns True on success, False if the entry was overwritten (or is not written yet)
+ */
+bool journal_read(const uint32_t sequence, struct journal_entry_t* const out);
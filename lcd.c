@@ -38,6 +38,15 @@
  * Originally copied from pico-examples, commit #7fe60d6b4027771e45d97f207532c41b1d8c5418, specifically file: i2c/lcd_1602_i2c/lcd_1602_i2c.c
  *
  * Modified to support 20x4 displays
+ *
+ * Modified to be non-blocking: the bytes for the PCF8574 go into a queue, which the i2c interrupt feeds into the TX FIFO
+ * of the i2c controller. The PCF8574 takes any number of bytes in one transfer, so every update is a single burst, in
+ * which the time each byte takes on the bus (@ref STATUS_LCD_I2C_BAUDRATE) spaces out the enable pulses. Commands that
+ * take the display longer than that are followed by repeats of the last byte.
+ *
+ * Modified to watch the display: aborted transfers, and a character and the address counter read back from the display
+ * now and then, detect a display that lost power or its 4 bit mode. It is then power cycled with
+ * @ref I2C_POWER_INTERRUPT_GPIO and initialized again from lcd_poll(), without blocking the caller.
  */
 
 #include "lcd.h"
@@ -45,6 +54,8 @@
 #include "config.h"
 
 #include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 #include "pico/stdlib.h"
 #include <stdio.h>
 #include <string.h>
@@ -97,6 +108,9 @@ const int LCD_BACKLIGHT = 0x08;
 
 const int LCD_ENABLE_BIT = 0x04;
 
+// Read/write bit of the PCF8574, while it and enable are high the display drives D7-D4
+#define LCD_READ 0x02
+
 static int addr = STATUS_LCD_I2C_ADDRESS;
 
 // Modes for lcd_send_byte
@@ -106,72 +120,480 @@ static int addr = STATUS_LCD_I2C_ADDRESS;
 #define MAX_LINES 4
 #define MAX_CHARS 20
 
-/* Quick helper function for single byte transfers */
-void i2c_write_byte(uint8_t val)
+/* Shadow of the display, so that only characters that changed are sent */
+static char lcd_frame[MAX_LINES][MAX_CHARS]; // What the display should show
+static char lcd_shadow[MAX_LINES][MAX_CHARS]; // What DDRAM holds
+static int cursor_line = 0; // Where lcd_string() writes next
+static int cursor_position = 0;
+static int ddram_line = -1; // Address counter of the display, ddram_line is -1 if unknown
+static int ddram_position = 0;
+
+// DDRAM address of the start of each line
+static const uint8_t lcd_row_starts[MAX_LINES] = { 0x00, 0x40, 0x14, 0x54 };
+
+static struct lcd_stats_t stats;
+
+// Time (in nanoseconds) a byte takes on the bus within a transfer: 8 bits and the ack
+#define LCD_BYTE_TIME_NS (9ull * 1000ull * 1000ull * 1000ull / STATUS_LCD_I2C_BAUDRATE)
+
+// HD44780U execution times (in microseconds) at its nominal 270 kHz oscillator
+#define LCD_EXEC_TIME_US 37
+#define LCD_EXEC_TIME_CLEAR_US 1520
+// The first function set in 8 bit mode during init
+#define LCD_EXEC_TIME_INIT_US 4100
+
+// Bytes for the PCF8574, as written to the data register of the i2c controller (Must be a power of 2)
+#define LCD_QUEUE_SIZE 1024
+static uint16_t lcd_queue[LCD_QUEUE_SIZE];
+static volatile uint32_t lcd_queue_head = 0; // Only written by the lcd_*() functions
+static volatile uint32_t lcd_queue_tail = 0; // Only written by lcd_i2c_irq(), or with interrupts disabled
+static uint8_t lcd_queue_last = 0; // Last byte queued
+
+#if STATUS_LCD_WATCHDOG_ENABLE
+enum lcd_watchdog_state_t
+{
+    LCD_WATCHDOG_RUNNING, // Display in use, checked every STATUS_LCD_VERIFY_INTERVAL
+    LCD_WATCHDOG_HOLD_OFF, // Waiting before the next power cycle, after one did not help
+    LCD_WATCHDOG_POWER_OFF, // Power interrupted
+    LCD_WATCHDOG_POWER_ON, // Power restored, waiting for the display to come up
+};
+
+static enum lcd_watchdog_state_t watchdog_state = LCD_WATCHDOG_RUNNING;
+static uint64_t watchdog_deadline = 0; // When the state changes, or the next check is due
+static uint32_t watchdog_retries = 0; // Power cycles since the display last read back correctly
+static volatile bool lcd_fault = false; // Set by lcd_i2c_irq() on an aborted transfer
+
+// Read back in flight
+static bool verify_pending = false;
+static uint64_t verify_deadline = 0;
+static uint8_t verify_char = 0; // Expected character
+static uint8_t verify_address = 0; // Expected address counter after reading the character
+static int verify_cell = 0; // Next cell to check, the checks go round the whole display
+#endif
+
+// Feed the TX FIFO from the queue, runs on the core that called lcd_init()
+static void lcd_i2c_irq(void)
 {
 #ifdef i2c_default
-    i2c_write_blocking(STATUS_LCD_I2C_INSTANCE, addr, &val, 1, false);
+    i2c_hw_t* const hw = i2c_get_hw(STATUS_LCD_I2C_INSTANCE);
+    if (hw->intr_stat & I2C_IC_INTR_STAT_R_TX_ABRT_BITS)
+    {
+        (void)hw->clr_tx_abrt;
+        stats.aborts++;
+#if STATUS_LCD_WATCHDOG_ENABLE
+        lcd_fault = true;
+#endif
+    }
+
+    uint32_t tail = lcd_queue_tail;
+    while (tail != lcd_queue_head && i2c_get_write_available(STATUS_LCD_I2C_INSTANCE))
+    {
+        hw->data_cmd = lcd_queue[tail % LCD_QUEUE_SIZE];
+        tail++;
+        stats.bytes++;
+    }
+    lcd_queue_tail = tail;
+    if (tail == lcd_queue_head)
+        hw_clear_bits(&hw->intr_mask, I2C_IC_INTR_MASK_M_TX_EMPTY_BITS);
+#endif
+}
+
+static void lcd_queue_push(uint16_t data_cmd)
+{
+    // Only a redraw of most of the display right after lcd_clear() can fill the queue
+    while (lcd_queue_head - lcd_queue_tail >= LCD_QUEUE_SIZE)
+        tight_loop_contents();
+    lcd_queue[lcd_queue_head % LCD_QUEUE_SIZE] = data_cmd;
+    lcd_queue_head++;
+#ifdef i2c_default
+    hw_set_bits(&i2c_get_hw(STATUS_LCD_I2C_INSTANCE)->intr_mask, I2C_IC_INTR_MASK_M_TX_EMPTY_BITS);
 #endif
 }
 
-void lcd_toggle_enable(uint8_t val)
+/* Queue a byte of the current transfer (The controller holds the bus while the queue runs dry mid-transfer) */
+void i2c_write_byte(uint8_t val)
+{
+    lcd_queue_push(val);
+    lcd_queue_last = val;
+}
+
+/* End the current transfer with a stop after the last byte queued */
+static void lcd_end_transfer(void)
+{
+    const uint32_t irq = save_and_disable_interrupts();
+    const bool queued = lcd_queue_head != lcd_queue_tail;
+    if (queued)
+        lcd_queue[(lcd_queue_head - 1) % LCD_QUEUE_SIZE] |= I2C_IC_DATA_CMD_STOP_BITS;
+    restore_interrupts(irq);
+    // Once the last byte is in the FIFO it is too late to mark it, repeating it changes nothing on the outputs
+    if (!queued)
+        lcd_queue_push(lcd_queue_last | I2C_IC_DATA_CMD_STOP_BITS);
+}
+
+/* Hold the outputs of the PCF8574 for at least us, by repeating the last byte */
+static void lcd_delay(uint32_t us)
 {
-    // Toggle enable pin on LCD display
-    // We cannot do this too quickly or things don't work
-#define DELAY_US 600
-    sleep_us(DELAY_US);
+    const uint64_t bytes = ((uint64_t)us * 1000ull + LCD_BYTE_TIME_NS - 1) / LCD_BYTE_TIME_NS;
+    for (uint64_t i = 0; i < bytes; i++)
+        i2c_write_byte(lcd_queue_last);
+}
+
+/* Account for the time a call blocked the caller, from start */
+static void lcd_account(uint64_t start)
+{
+    const uint64_t t = time_us_64() - start;
+    stats.busy_us += t;
+    if (t > stats.max_stall_us)
+        stats.max_stall_us = t > UINT32_MAX ? UINT32_MAX : (uint32_t)t;
+}
+
+// Send the upper 4 bits of val (with the mode and backlight bits) on a falling edge of enable
+static void lcd_send_nibble(uint8_t val)
+{
+    // RS and R/W must be set up before enable rises, the data bits only before it falls
+    if ((val ^ lcd_queue_last) & (LCD_CHARACTER | LCD_READ))
+        i2c_write_byte(val);
     i2c_write_byte(val | LCD_ENABLE_BIT);
-    sleep_us(DELAY_US);
-    i2c_write_byte(val & ~LCD_ENABLE_BIT);
-    sleep_us(DELAY_US);
+    i2c_write_byte(val);
 }
 
-// The display is sent a byte as two separate nibble transfers
-void lcd_send_byte(uint8_t val, int mode)
+// The display is sent a byte as two separate nibble transfers, exec_us is the time the display is busy after it
+static void lcd_send_byte_exec(uint8_t val, int mode, uint32_t exec_us)
 {
-    uint8_t high = mode | (val & 0xF0) | LCD_BACKLIGHT;
-    uint8_t low = mode | ((val << 4) & 0xF0) | LCD_BACKLIGHT;
+    lcd_send_nibble(mode | (val & 0xF0) | LCD_BACKLIGHT);
+    lcd_send_nibble(mode | ((val << 4) & 0xF0) | LCD_BACKLIGHT);
+    // The next falling edge of enable is at least 2 bytes away
+    const uint64_t busy_ns = (uint64_t)exec_us * 1000ull;
+    if (busy_ns > 2 * LCD_BYTE_TIME_NS)
+        lcd_delay((uint32_t)((busy_ns - 2 * LCD_BYTE_TIME_NS + 999) / 1000));
+}
+
+void lcd_send_byte(uint8_t val, int mode) { lcd_send_byte_exec(val, mode, LCD_EXEC_TIME_US); }
 
-    i2c_write_byte(high);
-    lcd_toggle_enable(high);
-    i2c_write_byte(low);
-    lcd_toggle_enable(low);
+// Whether the display can be written to (ie. it is not being power cycled)
+static bool lcd_running(void)
+{
+#if STATUS_LCD_WATCHDOG_ENABLE
+    return watchdog_state == LCD_WATCHDOG_RUNNING;
+#else
+    return true;
+#endif
 }
 
-void lcd_clear(void) { lcd_send_byte(LCD_CLEARDISPLAY, LCD_COMMAND); }
+// Clear the display and the shadow, the frame is left as is
+static void lcd_send_clear(void)
+{
+    lcd_send_byte_exec(LCD_CLEARDISPLAY, LCD_COMMAND, LCD_EXEC_TIME_CLEAR_US);
+    lcd_end_transfer();
+    memset(lcd_shadow, ' ', sizeof(lcd_shadow));
+    // Clear also returns the cursor home
+    ddram_line = 0;
+    ddram_position = 0;
+}
+
+void lcd_clear(void)
+{
+    const uint64_t start = time_us_64();
+    // While the display is power cycled lcd_poll() clears it once it is back
+    if (lcd_running())
+        lcd_send_clear();
+    memset(lcd_frame, ' ', sizeof(lcd_frame));
+    cursor_line = 0;
+    cursor_position = 0;
+    lcd_account(start);
+}
+
+// move the address counter of the LCD
+static void lcd_send_cursor(int line, int position)
+{
+    lcd_send_byte((lcd_row_starts[line % MAX_LINES] + position) | LCD_SETDDRAMADDR, LCD_COMMAND);
+    ddram_line = line;
+    ddram_position = position;
+    stats.cursor_commands++;
+}
 
 // go to location on LCD
 void lcd_set_cursor(int line, int position)
 {
-    uint8_t row_starts[] = { 0x00, 0x40, 0x14, 0x54 };
-    lcd_send_byte((row_starts[line % (sizeof(row_starts) / sizeof(*row_starts))] + position) | LCD_SETDDRAMADDR, LCD_COMMAND);
+    cursor_line = line % MAX_LINES;
+    cursor_position = position;
 }
 
 static inline void lcd_char(char val) { lcd_send_byte(val, LCD_CHARACTER); }
 
+void lcd_flush(void)
+{
+    if (!lcd_running())
+        return;
+    const uint64_t start = time_us_64();
+    const uint32_t head = lcd_queue_head;
+    for (int line = 0; line < MAX_LINES; line++)
+    {
+        for (int position = 0; position < MAX_CHARS; position++)
+        {
+            const char c = lcd_frame[line][position];
+            if (c == lcd_shadow[line][position])
+                continue;
+            // Runs of changed characters only need the cursor moved to their start
+            if (ddram_line != line || ddram_position != position)
+                lcd_send_cursor(line, position);
+            lcd_char(c);
+            lcd_shadow[line][position] = c;
+            stats.cells_written++;
+            // Past the end of a line the address counter continues in DDRAM order (0, 2, 1, 3)
+            if (++ddram_position == MAX_CHARS)
+                ddram_line = -1;
+        }
+    }
+    // Everything changed goes in one transfer
+    if (lcd_queue_head != head)
+        lcd_end_transfer();
+    lcd_account(start);
+}
+
 void lcd_string(const char* s)
 {
-    while (*s)
+    for (; *s && cursor_position < MAX_CHARS; s++, cursor_position++)
     {
-        lcd_char(*s++);
+        if (*s == lcd_shadow[cursor_line][cursor_position])
+            stats.cells_skipped++;
+        lcd_frame[cursor_line][cursor_position] = *s;
     }
+    lcd_flush();
+}
+
+// Initialization by instruction (HD44780U datasheet, figure 24): 8 bit function set 3 times, then 4 bit mode
+static void lcd_send_init(void)
+{
+    lcd_send_nibble(0x30 | LCD_BACKLIGHT);
+    lcd_delay(LCD_EXEC_TIME_INIT_US);
+    lcd_send_nibble(0x30 | LCD_BACKLIGHT);
+    lcd_delay(100);
+    lcd_send_nibble(0x30 | LCD_BACKLIGHT);
+    lcd_delay(LCD_EXEC_TIME_US);
+    lcd_send_nibble(0x20 | LCD_BACKLIGHT);
+    lcd_delay(LCD_EXEC_TIME_US);
+
+    lcd_send_byte(LCD_FUNCTIONSET | LCD_2LINE, LCD_COMMAND);
+    lcd_send_byte(LCD_DISPLAYCONTROL | LCD_DISPLAYON, LCD_COMMAND);
+    lcd_send_byte(LCD_ENTRYMODESET | LCD_ENTRYLEFT, LCD_COMMAND);
+    lcd_end_transfer();
+}
+
+void lcd_get_stats(struct lcd_stats_t* const out)
+{
+    // lcd_i2c_irq() counts bytes and aborts
+    const uint32_t irq = save_and_disable_interrupts();
+    *out = stats;
+    restore_interrupts(irq);
+#if STATUS_LCD_WATCHDOG_ENABLE
+    out->recovering = watchdog_state != LCD_WATCHDOG_RUNNING || watchdog_retries > 0;
+#endif
 }
 
 void lcd_init()
 {
-    i2c_init(STATUS_LCD_I2C_INSTANCE, 100 * 1000);
+    i2c_init(STATUS_LCD_I2C_INSTANCE, STATUS_LCD_I2C_BAUDRATE);
     gpio_set_function(STATUS_LCD_I2C_SDA_PIN, GPIO_FUNC_I2C);
     gpio_set_function(STATUS_LCD_I2C_SCL_PIN, GPIO_FUNC_I2C);
     gpio_pull_up(STATUS_LCD_I2C_SDA_PIN);
     gpio_pull_up(STATUS_LCD_I2C_SCL_PIN);
 
-    lcd_send_byte(0x03, LCD_COMMAND);
-    lcd_send_byte(0x03, LCD_COMMAND);
-    lcd_send_byte(0x03, LCD_COMMAND);
-    lcd_send_byte(0x02, LCD_COMMAND);
+#ifdef i2c_default
+    // The target address only changes with the controller disabled, as in i2c_write_blocking()
+    i2c_hw_t* const hw = i2c_get_hw(STATUS_LCD_I2C_INSTANCE);
+    hw->enable = 0;
+    hw->tar = addr;
+    hw->enable = 1;
+    hw->intr_mask = I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+    irq_set_exclusive_handler(I2C0_IRQ + i2c_get_index(STATUS_LCD_I2C_INSTANCE), lcd_i2c_irq);
+    irq_set_enabled(I2C0_IRQ + i2c_get_index(STATUS_LCD_I2C_INSTANCE), true);
+#endif
 
-    lcd_send_byte(LCD_ENTRYMODESET | LCD_ENTRYLEFT, LCD_COMMAND);
-    lcd_send_byte(LCD_FUNCTIONSET | LCD_2LINE, LCD_COMMAND);
-    lcd_send_byte(LCD_DISPLAYCONTROL | LCD_DISPLAYON, LCD_COMMAND);
+    const uint64_t start = time_us_64();
+    lcd_send_init();
+    lcd_account(start);
     lcd_clear();
 }
+
+#if STATUS_LCD_WATCHDOG_ENABLE
+// Queue a read of D7-D4 into the upper 4 bits of a byte in the RX FIFO, on a pulse of enable
+static void lcd_read_nibble(uint8_t mode)
+{
+    // The PCF8574 only releases the data lines when they are written high
+    const uint8_t val = 0xF0 | LCD_READ | mode | LCD_BACKLIGHT;
+    if (val != lcd_queue_last)
+        i2c_write_byte(val);
+    i2c_write_byte(val | LCD_ENABLE_BIT);
+    // Changing direction makes the controller send a restart, the outputs of the PCF8574 stay as they are
+    lcd_queue_push(I2C_IC_DATA_CMD_CMD_BITS);
+    i2c_write_byte(val);
+}
+
+// Discard whatever the RX FIFO holds
+static void lcd_drain_rx(void)
+{
+#ifdef i2c_default
+    while (i2c_get_read_available(STATUS_LCD_I2C_INSTANCE))
+        (void)i2c_read_byte_raw(STATUS_LCD_I2C_INSTANCE);
+#endif
+}
+
+// Read back the next cell of the display and the address counter, the result is checked by lcd_poll()
+static void lcd_verify(const uint64_t cur)
+{
+    const int line = verify_cell / MAX_CHARS;
+    const int position = verify_cell % MAX_CHARS;
+    verify_cell = (verify_cell + 1) % (MAX_LINES * MAX_CHARS);
+
+    lcd_drain_rx();
+    if (ddram_line != line || ddram_position != position)
+        lcd_send_cursor(line, position);
+    lcd_read_nibble(LCD_CHARACTER);
+    lcd_read_nibble(LCD_CHARACTER);
+    // Reading a character is an operation like any other, the busy flag must be clear once the address counter is read
+    lcd_delay(LCD_EXEC_TIME_US);
+    lcd_read_nibble(LCD_COMMAND);
+    lcd_read_nibble(LCD_COMMAND);
+    lcd_end_transfer();
+
+    // In 2 line mode the address counter skips from the end of each DDRAM line to the start of the other
+    const uint8_t address = lcd_row_starts[line] + position;
+    verify_char = (uint8_t)lcd_shadow[line][position];
+    verify_address = address == 0x27 ? 0x40 : address == 0x67 ? 0x00 : address + 1;
+    ddram_line = line;
+    ddram_position = position + 1;
+    if (ddram_position == MAX_CHARS)
+        ddram_line = -1;
+
+    verify_pending = true;
+    verify_deadline = cur + STATUS_LCD_VERIFY_TIMEOUT;
+}
+
+// Check the result of lcd_verify(), returns false if it is not in the RX FIFO yet
+static bool lcd_verify_result(bool* const ok)
+{
+#ifdef i2c_default
+    if (i2c_get_read_available(STATUS_LCD_I2C_INSTANCE) < 4)
+        return false;
+    uint8_t r[4];
+    for (size_t i = 0; i < 4; i++)
+        r[i] = i2c_read_byte_raw(STATUS_LCD_I2C_INSTANCE) & 0xF0;
+    // The busy flag is the top bit of the address counter read
+    *ok = (r[0] | r[1] >> 4) == verify_char && (r[2] | r[3] >> 4) == verify_address;
+    return true;
+#else
+    (void)ok;
+    return false;
+#endif
+}
+
+// Stop sending to the display, and power cycle it once the hold off for repeated failures has passed
+static void lcd_watchdog_fail(const uint64_t cur)
+{
+    stats.failures++;
+    verify_pending = false;
+
+    // Whatever is still queued is for a display in an unknown state, the transfer in progress still needs its stop
+    const uint32_t irq = save_and_disable_interrupts();
+    lcd_queue_tail = lcd_queue_head;
+    restore_interrupts(irq);
+    lcd_end_transfer();
+
+    uint64_t hold_off = 0;
+    if (watchdog_retries > 0)
+    {
+        hold_off = STATUS_LCD_RETRY_TIME;
+        for (uint32_t i = 1; i < watchdog_retries && hold_off < STATUS_LCD_RETRY_TIME_MAX; i++)
+            hold_off *= 2;
+        if (hold_off > STATUS_LCD_RETRY_TIME_MAX)
+            hold_off = STATUS_LCD_RETRY_TIME_MAX;
+    }
+    watchdog_retries++;
+    watchdog_state = LCD_WATCHDOG_HOLD_OFF;
+    watchdog_deadline = cur + hold_off;
+}
+#endif
+
+void lcd_poll(void)
+{
+#if STATUS_LCD_WATCHDOG_ENABLE
+    const uint64_t cur = time_us_64();
+    switch (watchdog_state)
+    {
+    case LCD_WATCHDOG_RUNNING:
+    {
+        bool failed = lcd_fault;
+        bool ok = false;
+        if (!failed && verify_pending && lcd_verify_result(&ok))
+        {
+            verify_pending = false;
+            stats.checks++;
+            if (!ok)
+                failed = true;
+            else if (watchdog_retries > 0)
+            {
+                stats.recoveries++;
+                watchdog_retries = 0;
+            }
+        }
+        else if (!failed && verify_pending && cur >= verify_deadline)
+            failed = true;
+
+        if (failed)
+            lcd_watchdog_fail(cur);
+        else if (!verify_pending && cur >= watchdog_deadline)
+        {
+            const uint64_t start = time_us_64();
+            lcd_verify(cur);
+            lcd_account(start);
+            watchdog_deadline = cur + STATUS_LCD_VERIFY_INTERVAL;
+        }
+        break;
+    }
+    case LCD_WATCHDOG_HOLD_OFF:
+        if (cur < watchdog_deadline)
+            break;
+        gpio_put(I2C_POWER_INTERRUPT_GPIO, I2C_POWER_INTERRUPT_ACTIVE_LOGIC_LEVEL);
+        watchdog_state = LCD_WATCHDOG_POWER_OFF;
+        watchdog_deadline = cur + I2C_POWER_WAIT_TIME;
+        break;
+    case LCD_WATCHDOG_POWER_OFF:
+        if (cur < watchdog_deadline)
+            break;
+        gpio_put(I2C_POWER_INTERRUPT_GPIO, !I2C_POWER_INTERRUPT_ACTIVE_LOGIC_LEVEL);
+        watchdog_state = LCD_WATCHDOG_POWER_ON;
+        watchdog_deadline = cur + I2C_POWER_WAIT_TIME;
+        break;
+    case LCD_WATCHDOG_POWER_ON:
+    {
+        if (cur < watchdog_deadline)
+            break;
+        // Anything sent while the power was off was aborted
+        lcd_drain_rx();
+        lcd_fault = false;
+        watchdog_state = LCD_WATCHDOG_RUNNING;
+        // Check right after the redraw, a display that reads back correctly counts as recovered
+        watchdog_deadline = cur;
+        const uint64_t start = time_us_64();
+        lcd_send_init();
+        lcd_send_clear();
+        lcd_account(start);
+        lcd_flush();
+        break;
+    }
+    }
+#endif
+}
+
+uint64_t lcd_next_deadline(void)
+{
+#if STATUS_LCD_WATCHDOG_ENABLE
+    // Checks wait for the next call to lcd_poll() the caller makes anyway
+    if (watchdog_state == LCD_WATCHDOG_RUNNING)
+        return UINT64_MAX;
+    return watchdog_deadline;
+#else
+    return UINT64_MAX;
+#endif
+}
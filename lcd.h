@@ -32,19 +32,73 @@
 #pragma once
 
 #include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Traffic of the LCD driver, and what the shadow of the display saved */
+struct lcd_stats_t
+{
+    uint32_t bytes; ///< Bytes written to or read from the PCF8574 (Not counting the address byte of each transfer)
+    uint64_t busy_us; ///< Time (in microseconds) spent in the lcd_*() functions, ie. queueing bytes
+    uint32_t max_stall_us; ///< Longest time (in microseconds) a single lcd_*() call blocked the caller
+    uint32_t aborts; ///< Transfers aborted by the i2c controller (eg. no ack from the PCF8574)
+    uint32_t cells_written; ///< Characters sent to the display
+    uint32_t cells_skipped; ///< Characters not sent, as the display already showed them
+    uint32_t cursor_commands; ///< Set DDRAM address commands sent
+    uint32_t checks; ///< Read backs of the display that completed (@ref STATUS_LCD_WATCHDOG_ENABLE)
+    uint32_t failures; ///< Aborted transfers, or read backs that failed, each of which led to a power cycle
+    uint32_t recoveries; ///< Power cycles after which the display read back correctly again
+    bool recovering; ///< The display is being power cycled, or has not read back correctly since
+};
 
 /**
  * Initialize LCD
  *
+ * Writes are queued and sent by the i2c interrupt, on the core that calls this
+ *
  * @ref config.h For configuration
  */
 void lcd_init();
 
-/** Write string to LCD */
+/**
+ * Write string to LCD at the cursor, clipped to the end of the line
+ *
+ * Only characters that differ from what the display already shows are sent
+ */
 void lcd_string(const char* s);
 
 /** Clear LCD */
 void lcd_clear(void);
 
-/** Set LCD cursor position */
+/** Set LCD cursor position (Nothing is sent until characters that differ are written) */
 void lcd_set_cursor(int line, int position);
+
+/**
+ * Send every character that differs from what the display shows
+ *
+ * lcd_string() already does this, the display is only out of date if a previous write was interrupted
+ */
+void lcd_flush(void);
+
+/**
+ * Watch the display, and power cycle and initialize it again when it fails (@ref STATUS_LCD_WATCHDOG_ENABLE)
+ *
+ * Call often from the core that called lcd_init(), at the latest by lcd_next_deadline(). Never blocks for the power cycle,
+ * in the meantime lcd_string() only updates what the display is to show once it is back. @ref I2C_POWER_INTERRUPT_GPIO
+ * must already be an output, as main() sets it up.
+ */
+void lcd_poll(void);
+
+/**
+ * Get the next time (in microseconds since boot) that lcd_poll() has to run to continue a power cycle
+ *
+ * @returns UINT64_MAX if no power cycle is in progress (Checks of the display run whenever lcd_poll() is called)
+ */
+uint64_t lcd_next_deadline(void);
+
+/**
+ * Get the traffic counters of the LCD driver
+ *
+ * @param out Output counters
+ */
+void lcd_get_stats(struct lcd_stats_t* const out);
@@ -43,21 +43,33 @@ loop_measure_t loop_measure_init()
     return r;
 }
 
+void loop_measure_add_sleep(loop_measure_t* obj, const microseconds_t us) { obj->current_sleep_time += us; }
+
 void loop_measure_end_loop(loop_measure_t* obj)
 {
     uint64_t cur_time = time_us_64();
     if (obj->last_push == ~0ull)
         obj->last_push = cur_time;
 
-    obj->loop_times[obj->loop_times_pos++] = cur_time - obj->last_push;
+    obj->loop_times[obj->loop_times_pos] = cur_time - obj->last_push;
+    obj->sleep_times[obj->loop_times_pos++] = obj->current_sleep_time;
     obj->loop_times_pos %= LOOP_AVERAGE_SAMPLE_COUNT;
     obj->last_push = cur_time;
+    obj->current_sleep_time = 0;
 
     microseconds_t new_average_loop_time = 0;
+    microseconds_t total_sleep_time = 0;
     for (uint32_t i = 0; i < LOOP_AVERAGE_SAMPLE_COUNT; i++)
+    {
         new_average_loop_time += obj->loop_times[i];
+        total_sleep_time += obj->sleep_times[i];
+    }
+    const microseconds_t total_loop_time = new_average_loop_time;
     new_average_loop_time /= (microseconds_t)(LOOP_AVERAGE_SAMPLE_COUNT);
 
     obj->average_loop_time = new_average_loop_time;
     obj->loops_per_second = ((double)(MICROSECONDS_PER_SECOND)) / ((double)(obj->average_loop_time));
+    obj->wakeups_per_hour = obj->loops_per_second * 3600.0;
+    if (total_loop_time > 0)
+        obj->busy_percent = 100.0 * (double)(total_loop_time - total_sleep_time) / (double)(total_loop_time);
 }
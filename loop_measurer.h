@@ -42,11 +42,24 @@ typedef struct
 {
     uint64_t last_push;
     microseconds_t loop_times[LOOP_AVERAGE_SAMPLE_COUNT];
+    microseconds_t sleep_times[LOOP_AVERAGE_SAMPLE_COUNT];
+    microseconds_t current_sleep_time;
     microseconds_t average_loop_time;
     uint32_t loop_times_pos;
     float loops_per_second;
+    /** Equal to loops per hour, as every loop of a sleeping core is one wake-up */
+    float wakeups_per_hour;
+    /** Percentage of time not spent in loop_measure_add_sleep() */
+    float busy_percent;
 } loop_measure_t;
 
 loop_measure_t loop_measure_init();
 
+/**
+ * Record time spent sleeping during the current loop
+ *
+ * @param us Microseconds slept
+ */
+void loop_measure_add_sleep(loop_measure_t* obj, const microseconds_t us);
+
 void loop_measure_end_loop(loop_measure_t* obj);
@@ -60,9 +60,13 @@
 #include "pico/multicore.h"
 #include "pico/stdlib.h"
 
+#include "actuator.h"
 #include "ftime.h"
+#include "journal.h"
 #include "loop_measurer.h"
+#include "schedule_upload.h"
 #include "unix_time.h"
+#include "wear_log.h"
 
 #define LOG(fmt, ...) printf("Core %u: " fmt, get_core_num(), ##__VA_ARGS__)
 
@@ -143,18 +147,54 @@ void dump_program_info()
     LOG("===> Actuator config\n");
     LOG("Travel time: %s\n", fdelta_us(ACTUATOR_TRAVEL_TIME, FBUF()));
     LOG("Rest time:   %s\n", fdelta_us(ACTUATOR_REST_TIME, FBUF()));
+    LOG("Stroke time: %s\n", fdelta_us(ACTUATOR_STROKE_TIME, FBUF()));
+    LOG("Position margin: %s\n", fdelta_us(ACTUATOR_POSITION_MARGIN, FBUF()));
+    LOG("Retain positions: %d\n", ACTUATOR_RETAIN_POSITION);
     LOG("GPIO 'ON'  Extend:  %d\n", ACTUATOR_GPIO_ACT_ON_EXTEND);
     LOG("GPIO 'ON'  Retract: %d\n", ACTUATOR_GPIO_ACT_ON_RETRACT);
     LOG("GPIO 'OFF' Extend:  %d\n", ACTUATOR_GPIO_ACT_OFF_EXTEND);
     LOG("GPIO 'OFF' Retract: %d\n", ACTUATOR_GPIO_ACT_OFF_RETRACT);
     LOG("Active logic level extend:  %s\n", (ACTUATOR_ACTIVE_LOGIC_LEVEL_EXTEND) ? "HIGH" : "LOW");
     LOG("Active logic level retract: %s\n", (ACTUATOR_ACTIVE_LOGIC_LEVEL_RETRACT) ? "HIGH" : "LOW");
+    LOG("Alarm driven edges: %d\n", ACTUATOR_ALARM_EDGES);
+    LOG("Backend: %s\n", ACTUATOR_BACKEND == ACTUATOR_BACKEND_PIO ? "PIO" : "CPU");
     putc('\n', stdout);
     LOG("===> Schedule config\n");
     LOG("Select pin: %d\n", SCHEDULE_SELECT_PIN);
+#define LOG_ACTUATOR(gpio_extend, gpio_retract) LOG("Actuator: Extend GPIO %d, Retract GPIO %d\n", gpio_extend, gpio_retract);
+    ACTUATOR_TABLE(LOG_ACTUATOR)
+#define LOG_ZONE(level, gpio_select, select_active_level, actuator_on, actuator_off, trigger_policy, trigger_cycles)                                     \
+    LOG("Zone L%d: Select GPIO %d (%s), 'ON' actuator %d, 'OFF' actuator %d, %s (%d)\n", level, gpio_select, (select_active_level) ? "HIGH" : "LOW", \
+        actuator_on, actuator_off, #trigger_policy, trigger_cycles);
+    ZONE_TABLE(LOG_ZONE)
     LOG("Region trigger duration: %s\n", fdelta(SCHEDULE_TRIGGER_REGION_LENGTH, FBUF()));
     LOG("Trigger on reset if in 'ON'  region: %d\n", SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_ON_REGION);
     LOG("Trigger on reset if in 'OFF' region: %d\n", SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_OFF_REGION);
+#if SCHEDULE_SOURCE == SCHEDULE_SOURCE_TABLES
+    LOG("Schedule source: Expanded tables\n");
+#elif SCHEDULE_SOURCE == SCHEDULE_SOURCE_RULES
+    LOG("Schedule source: Recurrence rules\n");
+#elif SCHEDULE_SOURCE == SCHEDULE_SOURCE_PACKED
+    LOG("Schedule source: Packed tables\n");
+#endif
+    LOG("Schedule partition enabled: %d\n", SCHEDULE_PARTITION_ENABLE);
+    LOG("Schedule partition offset:  0x%08x\n", SCHEDULE_PARTITION_OFFSET);
+    LOG("Schedule partition size:    %u\n", SCHEDULE_PARTITION_SIZE);
+    LOG("Schedule partition slots:   %u x %u\n", SCHEDULE_PARTITION_NUM_SLOTS, SCHEDULE_PARTITION_SLOT_SIZE);
+    LOG("Schedule upload enabled: %d\n", SCHEDULE_UPLOAD_ENABLE);
+    LOG("Schedule upload port:    %d\n", SCHEDULE_UPLOAD_PORT);
+    LOG("Flash guard time:        %s\n", fdelta_us(FLASH_GUARD_TIME, FBUF()));
+    putc('\n', stdout);
+    LOG("===> Wear log config\n");
+    LOG("Wear log enabled:  %d\n", WEAR_LOG_ENABLE);
+    LOG("Wear log offset:   0x%08x\n", WEAR_LOG_OFFSET);
+    LOG("Wear log size:     %u\n", WEAR_LOG_SIZE);
+    LOG("Wear log interval: %s\n", fdelta_us(WEAR_LOG_COMMIT_INTERVAL, FBUF()));
+    putc('\n', stdout);
+    LOG("===> Journal config\n");
+    LOG("Journal enabled:  %d\n", JOURNAL_ENABLE);
+    LOG("Journal size:     %u entries\n", JOURNAL_SIZE);
+    LOG("Journal dump key: '%c'\n", JOURNAL_DUMP_KEY);
     putc('\n', stdout);
     LOG("===> Timezone config\n");
     LOG("Offset Daylight Time: %s\n", fdelta(TIMEZONE_OFFSET_DT, FBUF()));
@@ -163,6 +203,7 @@ void dump_program_info()
     LOG("===> LCD config\n");
     LOG("i2c instance:  %d\n", (STATUS_LCD_I2C_INSTANCE == i2c0) ? 0 : 1);
     LOG("i2c address:   %02x (%d)\n", STATUS_LCD_I2C_ADDRESS, STATUS_LCD_I2C_ADDRESS);
+    LOG("i2c baudrate:  %u\n", STATUS_LCD_I2C_BAUDRATE);
     LOG("i2c SDL GPIO:  %d\n", STATUS_LCD_I2C_SDA_PIN);
     LOG("i2c SCL GPIO:  %d\n", STATUS_LCD_I2C_SCL_PIN);
     LOG("Page interval: %s\n", fdelta_us(((uint64_t)STATUS_LCD_INTERVALS_PER_PAGE) * STATUS_PRINT_INTERVAL, FBUF()));
@@ -176,10 +217,65 @@ void dump_program_info()
     LOG("WS2812 Status Heartbeat Period: %d\n", WS2812_STATUS_HEARTBEAT_PERIOD);
     LOG("USB STDIO wait time: %s\n", fdelta_us(MAX_WAIT_USB_STDIO, FBUF()));
     LOG("Loop averaging sample count: %d\n", LOOP_AVERAGE_SAMPLE_COUNT);
+    LOG("Core 1 tickless: %d\n", CORE1_TICKLESS);
     LOG("Automatic reboot interval: %s\n", fdelta(AUTOMATIC_REBOOT_INTERVAL, FBUF()));
     LOG("Automatic reboot minimum distance to region: %s\n", fdelta(AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION, FBUF()));
 }
 
+#if JOURNAL_ENABLE
+#define ZONE_NAME(level, ...) "L" #level,
+static const char* const zone_names[] = { ZONE_TABLE(ZONE_NAME) };
+
+/** Print every entry still in the journal, oldest first */
+static void dump_journal()
+{
+    static const char* const phase_names[] = { "idle", "extend", "retract" };
+    char fbuf0[64];
+    const uint32_t head = journal_get_head();
+    const uint32_t first = head - 1 > JOURNAL_SIZE ? head - JOURNAL_SIZE : 1;
+    uint32_t lost = 0;
+
+    LOG("===> Journal (%u entries)\n", head - first);
+    for (uint32_t sequence = first; sequence != head; sequence++)
+    {
+        struct journal_entry_t e;
+        /* Core 1 keeps recording while this prints */
+        if (!journal_read(sequence, &e))
+        {
+            lost++;
+            continue;
+        }
+        printf("%8u %s %14llu us: ", e.sequence, ftime_us(e.unix_time, FBUF(0)), e.timestamp);
+        const char* const zone = e.id < arraysize(zone_names) ? zone_names[e.id] : "?";
+        switch (e.event)
+        {
+        case JOURNAL_BOOT:
+            printf("Boot, %u entries kept\n", e.value);
+            break;
+        case JOURNAL_ACTUATOR_PHASE:
+            printf("Actuator GPIO %u %s (%u us late)\n", e.id, e.arg < arraysize(phase_names) ? phase_names[e.arg] : "?", e.value);
+            break;
+        case JOURNAL_ACTUATOR_TRIGGER:
+            printf("Actuator GPIO %u trigger, extend %u us\n", e.id, e.value);
+            break;
+        case JOURNAL_ZONE_REGION:
+            printf("Zone %s region %s%s\n", zone, (e.arg & 1) ? "ON" : "OFF", (e.arg & 2) ? " (held off)" : "");
+            break;
+        case JOURNAL_ZONE_TRIGGER:
+            printf("Zone %s trigger %s\n", zone, e.arg ? "ON" : "OFF");
+            break;
+        case JOURNAL_ZONE_RESUME:
+            printf("Zone %s resume %s\n", zone, e.arg ? "ON" : "OFF");
+            break;
+        default:
+            printf("Unknown event %u\n", e.event);
+            break;
+        }
+    }
+    LOG("===> Journal end (%u entries overwritten while printing)\n", lost);
+}
+#endif
+
 int main()
 {
     gpio_init(SCHEDULE_SELECT_PIN);
@@ -242,6 +338,11 @@ int main()
     sntp_init();
     cyw43_arch_lwip_end();
 
+#if SCHEDULE_UPLOAD_ENABLE
+    LOG("Initializing schedule upload\n");
+    schedule_upload_init();
+#endif
+
     LOG("Setup done, beginning loop\n");
     while (1)
     {
@@ -252,6 +353,16 @@ int main()
             cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, (time_us_64() / 250000) & 1);
 
         cyw43_arch_poll();
+#if SCHEDULE_UPLOAD_ENABLE
+        schedule_upload_poll();
+#endif
+#if WEAR_LOG_ENABLE
+        wear_log_poll();
+#endif
+#if JOURNAL_ENABLE
+        if (getchar_timeout_us(0) == JOURNAL_DUMP_KEY)
+            dump_journal();
+#endif
 
         loop_measure_end_loop(&core0_loop_measure);
     }
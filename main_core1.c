@@ -31,18 +31,31 @@
  */
 
 #include "actuator.h"
+#include "crc32.h"
+#include "flash_guard.h"
+#include "journal.h"
 #include "lcd.h"
 #include "loop_measurer.h"
+#include "schedule_partition.h"
+#include "schedule_upload.h"
 #include "schedules.h"
 #include "unix_time.h"
+#include "wear_log.h"
+#include "zone.h"
 
 #include "config.h"
 
+#include <assert.h>
 #include <math.h>
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
+#include "hardware/regs/addressmap.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "pico/flash.h"
 #include "pico/time.h"
 
 #include "ftime.h"
@@ -51,59 +64,7 @@
 
 #define LOG(fmt, ...) printf("Core %u: " fmt, get_core_num(), ##__VA_ARGS__)
 
-typedef struct
-{
-    bool on;
-    bool allow_resume;
-    bool in_region;
-
-    /** Starting Timestamp (in seconds since 1970-01-01) of current region */
-    uint64_t timestamp_region_start;
-    /** Timestamp (in seconds since 1970-01-01) of the next "OFF" region */
-    uint64_t timestamp_region_next_off;
-    /** Timestamp (in seconds since 1970-01-01) of the next "ON" region */
-    uint64_t timestamp_region_next_on;
-} schedule_current_state_t;
-
-schedule_current_state_t schedule_get_state(const schedule_t* const schedule)
-{
-    const microseconds_t epoch_time = (get_unix_time() / 1000000ull) - schedule->epoch;
-
-    schedule_current_state_t r = { 0 };
-    r.timestamp_region_next_off = UINT64_MAX;
-    r.timestamp_region_next_on = UINT64_MAX;
-
-    for (uint32_t i = 0; i < schedule->num_entries; i++)
-    {
-        if (schedule->entries[i].timestamp < epoch_time)
-        {
-            r.on = schedule->entries[i].on;
-            r.allow_resume = schedule->entries[i].allow_resume
-                && (r.on ? SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_ON_REGION : SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_OFF_REGION);
-            r.timestamp_region_start = (uint64_t)(schedule->entries[i].timestamp) + schedule->epoch;
-            if (epoch_time < (microseconds_t)(schedule->entries[i].timestamp + SCHEDULE_TRIGGER_REGION_LENGTH))
-                r.in_region = 1;
-        }
-        else
-        {
-            if (schedule->entries[i].on)
-            {
-                if (r.timestamp_region_next_on == UINT64_MAX)
-                    r.timestamp_region_next_on = (uint64_t)(schedule->entries[i].timestamp) + schedule->epoch;
-            }
-            else
-            {
-                if (r.timestamp_region_next_off == UINT64_MAX)
-                    r.timestamp_region_next_off = (uint64_t)(schedule->entries[i].timestamp) + schedule->epoch;
-            }
-        }
-    }
-
-    return r;
-}
-
 static bool status_can_print = 0;
-static uint8_t status_lcd_page = 0;
 
 #if defined(__GNUC__) || defined(__clang__)
 #define formatting_attribute(fmtargnumber) __attribute__((format(__printf__, fmtargnumber, fmtargnumber + 1)))
@@ -119,11 +80,14 @@ static formatting_attribute(1) int status(const char* fmt, ...)
     return r;
 }
 
+#define arraysize(X) (sizeof(X) / sizeof(*(X)))
+
 #define LCD_WIDTH 20
 
-static formatting_attribute(4) void status_lcd(uint8_t page, uint8_t line, bool center, const char* fmt, ...)
+/** Write one line of the visible LCD page, only call from a status_lcd_render_t */
+static formatting_attribute(3) void status_lcd(uint8_t line, bool center, const char* fmt, ...)
 {
-    if (!status_can_print || page != status_lcd_page)
+    if (!status_can_print)
         return;
     char buf[LCD_WIDTH * 2 + 4];
     char* s = buf + LCD_WIDTH;
@@ -150,7 +114,48 @@ static formatting_attribute(4) void status_lcd(uint8_t page, uint8_t line, bool
     lcd_string(s);
 }
 
-static void setup_status_lcd(uint8_t num_pages) { status_lcd_page = (time_us_64() / (STATUS_PRINT_INTERVAL * STATUS_LCD_INTERVALS_PER_PAGE)) % num_pages; }
+/**
+ * Render callback for a group of LCD pages
+ *
+ * @param index Page index within the group
+ * @param unix_time Current unix time (in seconds)
+ */
+typedef void (*status_lcd_render_t)(uint8_t index, uint64_t unix_time);
+
+/** Group of LCD pages that share a render callback */
+struct status_lcd_page_group_t
+{
+    status_lcd_render_t render;
+    uint8_t num_pages;
+};
+
+/**
+ * Render the visible LCD page
+ *
+ * Pages are cycled through every STATUS_LCD_INTERVALS_PER_PAGE status intervals, only the visible page is
+ * formatted and only when a status refresh is due, so the page contents cost nothing in all other loops.
+ */
+static void status_lcd_render(const struct status_lcd_page_group_t* const groups, const size_t num_groups, const uint64_t unix_time)
+{
+    if (!status_can_print)
+        return;
+
+    unsigned num_pages = 0;
+    for (size_t i = 0; i < num_groups; i++)
+        num_pages += groups[i].num_pages;
+    if (num_pages == 0)
+        return;
+
+    unsigned page = (time_us_64() / (STATUS_PRINT_INTERVAL * STATUS_LCD_INTERVALS_PER_PAGE)) % num_pages;
+    for (size_t i = 0; i < num_groups; page -= groups[i++].num_pages)
+    {
+        if (page < groups[i].num_pages)
+        {
+            groups[i].render(page, unix_time);
+            return;
+        }
+    }
+}
 
 static void setup_status()
 {
@@ -202,6 +207,8 @@ static void minimal_status()
     status("Current:         %s\n", ftime_us(us_cur, FBUF(0)));
     status("loops/sec core0: %.3f\n", core0_loop_measure.loops_per_second);
     status("loops/sec core1: %.3f\n", core1_loop_measure.loops_per_second);
+    status("wakeups/h core1: %.0f\n", core1_loop_measure.wakeups_per_hour);
+    status("busy %% core1:    %.3f\n", core1_loop_measure.busy_percent);
 
     double r = 0.0;
     double g = 0.0;
@@ -223,8 +230,13 @@ static void minimal_status()
     g = _clamp(g, 0.0, 1.0);
     b = _clamp(b, 0.0, 1.0);
 
+#if CORE1_TICKLESS
+    /* Core 1 only wakes up for events, so step between the extremes of the sine wave once per status interval */
+    double heartbeat = ((us_up / STATUS_PRINT_INTERVAL) & 1) ? 0.375 : 1.0;
+#else
     double heartbeat_time = (double)((us_up / 1000ull) % ((uint64_t)(WS2812_STATUS_HEARTBEAT_PERIOD))) / ((double)(WS2812_STATUS_HEARTBEAT_PERIOD));
     double heartbeat = sin(6.28318530718 * heartbeat_time) * 0.3125 + 0.6875;
+#endif
 
     r *= heartbeat;
     g *= heartbeat;
@@ -245,6 +257,14 @@ static void minimal_status()
 #endif
     c.bytes[1] = b * 255;
 
+#if CORE1_TICKLESS
+    /* Only write the led when what it shows changes */
+    static uint32_t last_word = UINT32_MAX;
+    if (c.word == last_word)
+        return;
+    last_word = c.word;
+#endif
+
     /* Ensure WS2812 reset interval has passed */
     static uint64_t last_us_up = 0;
     uint64_t us_since_last = us_up - last_us_up;
@@ -257,10 +277,528 @@ static void minimal_status()
 #endif
 }
 
+#if SCHEDULE_PACKED_DECODE_BENCHMARK
+static void schedule_packed_benchmark(const char* name, const schedule_packed_t* const packed)
+{
+    uint32_t num_decoded = 0;
+    uint32_t checksum = 0;
+    const uint64_t time_start = time_us_64();
+    for (uint32_t pass = 0; pass < SCHEDULE_PACKED_DECODE_BENCHMARK; pass++)
+    {
+        schedule_packed_reader_t r;
+        schedule_packed_reader_init(&r, packed);
+        schedule_entry_t e;
+        while (schedule_packed_reader_next(&r, &e))
+        {
+            num_decoded++;
+            checksum += e.timestamp + e.on + e.allow_resume;
+        }
+    }
+    const uint64_t elapsed = time_us_64() - time_start;
+    const double seconds = (double)(elapsed ? elapsed : 1) / 1000000.0;
+
+    LOG("Packed decode benchmark (%s): %u entries (%u bytes) x %u passes in %s (checksum %08x)\n", name, packed->num_entries, packed->size,
+        SCHEDULE_PACKED_DECODE_BENCHMARK, fdelta_us(elapsed, FBUF(0)), checksum);
+    LOG("Packed decode benchmark (%s): %.3f Mentries/s, %.3f MB/s\n", name, num_decoded / seconds / 1e6,
+        (double)packed->size * SCHEDULE_PACKED_DECODE_BENCHMARK / seconds / 1e6);
+}
+#endif
+
+#define ZONE_COUNT(...) +1
+#define ACTUATOR_COUNT(...) +1
+#define NUM_ZONES (0 ZONE_TABLE(ZONE_COUNT))
+#define NUM_ACTUATORS (0 ACTUATOR_TABLE(ACTUATOR_COUNT))
+
+#define ZONE_CHECK(level, gpio_select, select_active_level, actuator_on, actuator_off, trigger_policy, trigger_cycles)                        \
+    static_assert((actuator_on) < NUM_ACTUATORS && (actuator_off) < NUM_ACTUATORS, "Zone L" #level " refers to a missing actuator"); \
+    static_assert((trigger_policy) != ZONE_TRIGGER_CYCLES || (trigger_cycles) > 0, "Zone L" #level " must cycle at least once");
+ZONE_TABLE(ZONE_CHECK)
+
+#define ZONE_CONFIG(level, gpio_select, select_active_level, actuator_on, actuator_off, trigger_policy, trigger_cycles) \
+    { "L" #level, gpio_select, select_active_level, actuator_on, actuator_off, trigger_policy, trigger_cycles },
+static const struct zone_config_t zone_configs[NUM_ZONES] = { ZONE_TABLE(ZONE_CONFIG) };
+
+#define ACTUATOR_GPIOS(gpio_extend, gpio_retract) { gpio_extend, gpio_retract },
+static const uint8_t actuator_gpios[NUM_ACTUATORS][2] = { ACTUATOR_TABLE(ACTUATOR_GPIOS) };
+
+#if SCHEDULE_SOURCE == SCHEDULE_SOURCE_TABLES
+#define ZONE_BUILTIN(level, ...) &schedule_level_##level,
+static const schedule_t* const builtin_schedules[NUM_ZONES] = { ZONE_TABLE(ZONE_BUILTIN) };
+#elif SCHEDULE_SOURCE == SCHEDULE_SOURCE_RULES
+#define ZONE_BUILTIN(level, ...) &schedule_level_##level##_rules,
+static const schedule_rules_t* const builtin_schedules[NUM_ZONES] = { ZONE_TABLE(ZONE_BUILTIN) };
+#elif SCHEDULE_SOURCE == SCHEDULE_SOURCE_PACKED
+#define ZONE_BUILTIN(level, ...) &schedule_level_##level##_packed,
+static const schedule_packed_t* const builtin_schedules[NUM_ZONES] = { ZONE_TABLE(ZONE_BUILTIN) };
+#else
+#error "Invalid SCHEDULE_SOURCE"
+#endif
+
+static struct actuator_t actuators[NUM_ACTUATORS];
+static struct zone_t zones[NUM_ZONES];
+
+/** Name of the schedules in use, for status output */
+static const char* schedule_source_name = "";
+
+#if SCHEDULE_PARTITION_ENABLE
+static schedule_packed_t partition_schedules[NUM_ZONES];
+#endif
+
+static void init_schedule_cursors()
+{
+#if SCHEDULE_PARTITION_ENABLE
+    /* Definition in the pico-sdk linker script */
+    extern char __flash_binary_end;
+    const uint8_t* const partition = (const uint8_t*)(XIP_BASE + SCHEDULE_PARTITION_OFFSET);
+
+    uint32_t sequence = 0;
+    int slot = -1;
+
+    if ((uintptr_t)&__flash_binary_end > (uintptr_t)partition)
+        LOG("Schedule partition @ %p overlaps the firmware (ends @ %p), ignoring it\n", partition, &__flash_binary_end);
+    else if ((slot = schedule_partition_find_active(partition, SCHEDULE_PARTITION_SLOT_SIZE, SCHEDULE_PARTITION_NUM_SLOTS, &sequence)) < 0)
+        LOG("No valid schedule partition slot @ %p, using built-in schedules\n", partition);
+    else if (!schedule_partition_load(partition + slot * SCHEDULE_PARTITION_SLOT_SIZE, SCHEDULE_PARTITION_SLOT_SIZE, partition_schedules, NUM_ZONES))
+        LOG("Schedule partition slot %d holds fewer than %d schedules, using built-in schedules\n", slot, NUM_ZONES);
+    else
+    {
+        LOG("Using schedules from partition @ %p, slot %d (sequence %u)\n", partition, slot, sequence);
+        schedule_source_name = "Partition";
+        for (size_t i = 0; i < NUM_ZONES; i++)
+            schedule_cursor_init_packed(&zones[i].cursor, &partition_schedules[i]);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+#if SCHEDULE_SOURCE == SCHEDULE_SOURCE_TABLES
+        schedule_source_name = "Built-in tables";
+        schedule_cursor_init(&zones[i].cursor, builtin_schedules[i]);
+#elif SCHEDULE_SOURCE == SCHEDULE_SOURCE_RULES
+        schedule_source_name = "Built-in rules";
+        schedule_cursor_init_rules(&zones[i].cursor, builtin_schedules[i]);
+#elif SCHEDULE_SOURCE == SCHEDULE_SOURCE_PACKED
+        schedule_source_name = "Built-in packed";
+        schedule_cursor_init_packed(&zones[i].cursor, builtin_schedules[i]);
+#endif
+    }
+}
+
+static_assert(NUM_ACTUATORS <= ACTUATOR_MAX_CPU, "Too many actuators for the output stage");
+
+static void actuators_poll() { actuator_poll_all(); }
+
+static bool actuators_in_cycle()
+{
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        if (actuator_in_cycle(&actuators[i]))
+            return true;
+    return false;
+}
+
+#if ACTUATOR_RETAIN_POSITION
+#define RETAINED_ACTUATORS_MAGIC 0x504C5350u /* "PLSP" */
+
+/** Actuator positions kept across watchdog reboots (RAM keeps its contents, a power cycle fails the CRC) */
+struct retained_actuators_t
+{
+    uint32_t magic;
+    /** Estimated positions (see actuator_get_position()) */
+    uint32_t positions[NUM_ACTUATORS];
+    uint32_t crc;
+};
+static struct retained_actuators_t __uninitialized_ram(retained_actuators);
+
+static uint32_t retained_actuators_crc() { return crc32_update(0, &retained_actuators, offsetof(struct retained_actuators_t, crc)); }
+
+/**
+ * Get the position of an actuator before the last reboot
+ *
+ * @returns Position, or -1 if unknown
+ */
+static int64_t retained_actuators_get(const size_t i)
+{
+    if (retained_actuators.magic != RETAINED_ACTUATORS_MAGIC || retained_actuators.crc != retained_actuators_crc())
+        return -1;
+    return retained_actuators.positions[i];
+}
+
+/** Save actuator positions, or mark them unknown while any actuator moves (A reboot then can't trust them) */
+static void retained_actuators_save()
+{
+    retained_actuators.magic = 0;
+    if (actuators_in_cycle())
+        return;
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        retained_actuators.positions[i] = actuator_get_position(&actuators[i]);
+    retained_actuators.magic = RETAINED_ACTUATORS_MAGIC;
+    retained_actuators.crc = retained_actuators_crc();
+}
+#endif
+
+static void status_actuators()
+{
+    if (!status_can_print)
+        return;
+
+    /* Rate over the time since the last printed status */
+    static struct actuator_output_stats_t last_stats;
+    static uint64_t last_time;
+    struct actuator_output_stats_t stats;
+    actuator_get_output_stats(&stats);
+    const uint64_t cur = time_us_64();
+    const double seconds = (double)(cur - last_time) / 1000000.0;
+    const double avoided_per_second = seconds > 0.0 ? (double)(stats.writes_avoided - last_stats.writes_avoided) / seconds : 0.0;
+    last_stats = stats;
+    last_time = cur;
+
+    status("\n==> Actuator Status\n");
+    status("Output syncs:         %u\n", stats.syncs);
+    status("Output writes:        %u\n", stats.writes);
+    status("Writes avoided/sec:   %.1f\n", avoided_per_second);
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        struct actuator_jitter_t j;
+        actuator_get_jitter(&actuators[i], &j);
+        status("Actuator %u backend:  %s\n", (unsigned)i, actuators[i].backend == ACTUATOR_BACKEND_PIO ? "PIO" : "CPU");
+        status("Actuator %u position: %s\n", (unsigned)i, fdelta_us(actuator_get_position(&actuators[i]), FBUF(0)));
+        status("Actuator %u edges:    %u\n", (unsigned)i, j.edges);
+        status("Actuator %u lateness: last %u us, avg %llu us, max %u us\n", (unsigned)i, j.last_us, j.edges ? j.total_us / j.edges : 0ull, j.max_us);
+    }
+}
+
+static void status_lcd_driver()
+{
+    if (!status_can_print)
+        return;
+
+    /* Rate over the time since the last printed status */
+    static struct lcd_stats_t last_stats;
+    static uint64_t last_time;
+    struct lcd_stats_t stats;
+    lcd_get_stats(&stats);
+    const uint64_t cur = time_us_64();
+    const double seconds = (double)(cur - last_time) / 1000000.0;
+    const double bytes_per_second = seconds > 0.0 ? (double)(stats.bytes - last_stats.bytes) / seconds : 0.0;
+    const double busy_ms_per_second = seconds > 0.0 ? (double)(stats.busy_us - last_stats.busy_us) / 1000.0 / seconds : 0.0;
+    last_stats = stats;
+    last_time = cur;
+
+    status("\n==> LCD Status\n");
+    status("Bytes/sec:            %.1f\n", bytes_per_second);
+    status("Busy ms/sec:          %.1f\n", busy_ms_per_second);
+    status("Max stall:            %u us\n", stats.max_stall_us);
+    status("Aborted transfers:    %u\n", stats.aborts);
+    status("Cells:                %u written, %u skipped\n", stats.cells_written, stats.cells_skipped);
+    status("Cursor commands:      %u\n", stats.cursor_commands);
+#if STATUS_LCD_WATCHDOG_ENABLE
+    status("Watchdog:             %s\n", stats.recovering ? "Recovering" : "OK");
+    status("Watchdog checks:      %u\n", stats.checks);
+    status("Watchdog failures:    %u (%u recovered)\n", stats.failures, stats.recoveries);
+#endif
+}
+
+#if SCHEDULE_UPLOAD_ENABLE || WEAR_LOG_ENABLE
+/**
+ * Tell core 0 when core 1 next has to act on time, so that flash operations (which pause core 1) can be kept away from it
+ *
+ * @param zones_valid Whether the zone states are valid (False before the first schedule evaluation)
+ */
+static void publish_next_event(const bool zones_valid, const uint64_t unix_time)
+{
+    const uint64_t cur = time_us_64();
+    uint64_t next = cur + (uint64_t)MICROSECONDS_PER_DAY;
+
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        const uint64_t edge = actuator_next_edge(&actuators[i]);
+        if (edge < next)
+            next = edge;
+    }
+
+    for (size_t i = 0; zones_valid && i < NUM_ZONES; i++)
+    {
+        if (!zones[i].enabled)
+            continue;
+        const uint64_t boundary = zone_next_change(&zones[i]);
+        const uint64_t seconds = boundary > unix_time ? boundary - unix_time : 0;
+        /* Actuators are (re)triggered at any time while a command is queued, or the trigger policy asks for more */
+        if (zone_busy(&zones[i]))
+            next = cur;
+        else if (seconds < (next - cur) / MICROSECONDS_PER_SECOND)
+            next = cur + seconds * (uint64_t)MICROSECONDS_PER_SECOND;
+    }
+
+    flash_guard_core1_next_event_ms = next / 1000;
+}
+#endif
+
+#if CORE1_TICKLESS
+static uint tickless_alarm;
+static volatile bool tickless_alarm_fired;
+
+static void tickless_alarm_callback(uint alarm_num)
+{
+    (void)alarm_num;
+    tickless_alarm_fired = true;
+}
+
+/**
+ * Get the next time (in microseconds since boot) that the main loop has something to do
+ *
+ * @param unix_time_us Current unix time (in microseconds)
+ */
+static uint64_t tickless_next_deadline(const microseconds_t unix_time_us)
+{
+    const uint64_t cur = time_us_64();
+    /* Also the only time the WS2812 status led changes, see minimal_status() */
+    uint64_t next = (cur / STATUS_PRINT_INTERVAL + 1) * STATUS_PRINT_INTERVAL;
+
+    /* actuator_poll() only switches once the edge has passed */
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        const uint64_t edge = actuator_next_edge(&actuators[i]);
+        if (edge != UINT64_MAX && edge + 1 < next)
+            next = edge + 1;
+    }
+
+    const uint64_t lcd_deadline = lcd_next_deadline();
+    if (lcd_deadline < next)
+        next = lcd_deadline < cur ? cur : lcd_deadline;
+
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        if (!zones[i].enabled)
+            continue;
+        const uint64_t change = zone_next_change(&zones[i]);
+        if (change == UINT64_MAX)
+            continue;
+        const microseconds_t change_us = (microseconds_t)change * MICROSECONDS_PER_SECOND;
+        if (change_us <= unix_time_us)
+            return cur;
+        if ((uint64_t)(change_us - unix_time_us) < next - cur)
+            next = cur + (change_us - unix_time_us);
+    }
+
+    return next;
+}
+
+/** Sleep until deadline (in microseconds since boot), a new schedule upload, or an earlier event */
+static void tickless_sleep_until(const uint64_t deadline)
+{
+    const uint64_t start = time_us_64();
+    tickless_alarm_fired = false;
+    if (!hardware_alarm_set_target(tickless_alarm, from_us_since_boot(deadline)))
+    {
+        while (!tickless_alarm_fired
+#if SCHEDULE_UPLOAD_ENABLE
+            && schedule_upload_generation == schedule_upload_generation_applied
+#endif
+        )
+            __wfe();
+        hardware_alarm_cancel(tickless_alarm);
+    }
+    loop_measure_add_sleep(&core1_loop_measure, time_us_64() - start);
+}
+#endif
+
+#define ACTV_IDLE(x) ((x) ? "ACTV" : "IDLE")
+#define RESUME_NO(x) ((x) ? "RES-Y" : "RES-N")
+#define ON_OFF(x) ((x) ? "ON " : "OFF")
+
+/** Number of LCD pages that show two zones each */
+#define LCD_PAGES_PAIRS ((NUM_ZONES + 1) / 2)
+
+/** Number of LCD pages that show the wear counters of two actuators each */
+#if WEAR_LOG_ENABLE
+#define LCD_PAGES_WEAR ((NUM_ACTUATORS + 1) / 2)
+#else
+#define LCD_PAGES_WEAR 0
+#endif
+
+static void status_lcd_zone(uint8_t line, const struct zone_t* const z)
+{
+    if (z->enabled)
+        status_lcd(line, true, "%s: %s %s %s", z->conf.name, ACTV_IDLE(z->state.in_region), RESUME_NO(z->state.allow_resume), ON_OFF(z->state.on));
+    else
+        status_lcd(line, true, "%s: Disabled", z->conf.name);
+}
+
+/** LCD page: Clock, uptime, and the state of two zones */
+static void status_lcd_page_pair(uint8_t index, uint64_t unix_time)
+{
+    status_lcd(0, true, "%s", ftime(unix_time, FBUF(0)));
+    status_lcd(1, true, "UP: %s", fdelta(time_us_64() / 1000000ull, FBUF(0)));
+    for (uint8_t line = 0; line < 2; line++)
+    {
+        const size_t i = index * 2 + line;
+        if (i < NUM_ZONES)
+            status_lcd_zone(2 + line, &zones[i]);
+        else
+            status_lcd(2 + line, true, "");
+    }
+}
+
+/** LCD page: State and region timestamps of one zone */
+static void status_lcd_page_zone(uint8_t index, uint64_t unix_time)
+{
+    (void)unix_time;
+    const struct zone_t* const z = &zones[index];
+    status_lcd_zone(0, z);
+    status_lcd(1, true, "CUR:%s", ftime_compact(z->state.timestamp_region_start, FBUF(0)));
+    status_lcd(2, true, "NON:%s", ftime_compact(z->state.timestamp_region_next_on, FBUF(0)));
+    status_lcd(3, true, "NOF:%s", ftime_compact(z->state.timestamp_region_next_off, FBUF(0)));
+}
+
+/** LCD page: Clock and the schedule end dates of two zones */
+static void status_lcd_page_end(uint8_t index, uint64_t unix_time)
+{
+    status_lcd(0, true, "%s", ftime(unix_time, FBUF(0)));
+    status_lcd(1, true, "Schedule end dates");
+    for (uint8_t line = 0; line < 2; line++)
+    {
+        const size_t i = index * 2 + line;
+        if (i < NUM_ZONES)
+        {
+            const uint64_t end = schedule_cursor_get_end(&zones[i].cursor);
+            status_lcd(2 + line, true, "%s: %s", zones[i].conf.name, end == UINT64_MAX ? "None" : ftime_compact(end, FBUF(0)));
+        }
+        else
+            status_lcd(2 + line, true, "");
+    }
+}
+
+static void status_zones(const uint64_t unix_time)
+{
+    if (!status_can_print)
+        return;
+
+    status("\n==> Schedule Status\n");
+    status("Source:               %s\n", schedule_source_name);
+#if SCHEDULE_UPLOAD_ENABLE
+    status("Schedule uploads:     %u\n", schedule_upload_generation - 1);
+#endif
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        const struct zone_t* const z = &zones[i];
+        const schedule_current_state_t* const s = &z->state;
+        status("Zone %s enabled:      %d\n", z->conf.name, z->enabled);
+        status("Zone %s state:        %d\n", z->conf.name, s->on);
+        status("Zone %s in_region:    %d\n", z->conf.name, s->in_region);
+        status("Zone %s allow_resume: %d\n", z->conf.name, s->allow_resume);
+        status("Zone %s command:      %s\n", z->conf.name, z->command.pending ? (z->command.on ? "ON" : "OFF") : "None");
+        status("Zone %s commands:     %u run, %u coalesced, %u superseded, %u expired, %u held off\n", z->conf.name,
+            z->command_stats.executed, z->command_stats.coalesced, z->command_stats.superseded, z->command_stats.expired, z->command_stats.held_off);
+        status("Zone %s region:       %u cycles%s\n", z->conf.name, z->region.cycles, z->region.held_off ? ", held off" : "");
+        status("Zone %s cur start:    %s (%s ago)\n", z->conf.name, ftime(s->timestamp_region_start, FBUF(0)),
+            fdelta(unix_time - s->timestamp_region_start, FBUF(1)));
+        status("Zone %s next on:      %s (in %s)\n", z->conf.name, ftime(s->timestamp_region_next_on, FBUF(0)),
+            fdelta(s->timestamp_region_next_on - unix_time, FBUF(1)));
+        status("Zone %s next off:     %s (in %s)\n", z->conf.name, ftime(s->timestamp_region_next_off, FBUF(0)),
+            fdelta(s->timestamp_region_next_off - unix_time, FBUF(1)));
+    }
+}
+
+#if WEAR_LOG_ENABLE
+/** LCD page: Wear counters of two actuators */
+static void status_lcd_page_wear(uint8_t index, uint64_t unix_time)
+{
+    (void)unix_time;
+    for (uint8_t line = 0; line < 4; line += 2)
+    {
+        const size_t i = index * 2 + line / 2;
+        if (i < NUM_ACTUATORS)
+        {
+            struct wear_counters_t w;
+            wear_log_get(i, &w);
+            status_lcd(line, true, "A%u: %u cyc %u abt", (unsigned)i, w.cycles, w.aborted);
+            status_lcd(line + 1, true, "E:%.1fh R:%.1fh", (double)w.extend_us / 3.6e9, (double)w.retract_us / 3.6e9);
+        }
+        else
+        {
+            status_lcd(line, true, "");
+            status_lcd(line + 1, true, "");
+        }
+    }
+}
+
+static void status_wear()
+{
+    if (!status_can_print)
+        return;
+
+    struct wear_log_stats_t stats;
+    wear_log_get_stats(&stats);
+    status("\n==> Wear Status\n");
+    status("Log commits:          %u\n", stats.commits);
+    status("Log erases:           %u\n", stats.erases);
+    status("Log failures:         %u\n", stats.failures);
+    status("Log max stall:        %u us\n", stats.max_stall_us);
+
+    for (size_t i = 0; i < NUM_ACTUATORS; i++)
+    {
+        struct wear_counters_t w;
+        wear_log_get(i, &w);
+        status("Actuator %u cycles:   %u (%u aborted)\n", (unsigned)i, w.cycles, w.aborted);
+        status("Actuator %u extended: %s\n", (unsigned)i, fdelta_us(w.extend_us, FBUF(0)));
+        status("Actuator %u retracted: %s\n", (unsigned)i, fdelta_us(w.retract_us, FBUF(0)));
+    }
+}
+#endif
+
+/** LCD pages of the main loop: zone pairs, one page per zone, schedule end dates of zone pairs, then wear counters */
+static const struct status_lcd_page_group_t status_lcd_pages[] = {
+    { status_lcd_page_pair, LCD_PAGES_PAIRS },
+    { status_lcd_page_zone, NUM_ZONES },
+    { status_lcd_page_end, LCD_PAGES_PAIRS },
+#if WEAR_LOG_ENABLE
+    { status_lcd_page_wear, LCD_PAGES_WEAR },
+#endif
+};
+
+/** LCD page: Waiting for the network or SNTP */
+static void status_lcd_page_wait_sync(uint8_t index, uint64_t unix_time)
+{
+    (void)index;
+    (void)unix_time;
+    status_lcd(0, true, "UP: %s", fdelta(time_us_64() / 1000000ull, FBUF(0)));
+    status_lcd(1, true, "Waiting for");
+    if (core0_connected)
+    {
+        status_lcd(2, true, "SNTP");
+        status_lcd(3, true, "");
+    }
+    else
+    {
+        status_lcd(2, true, "Network");
+        status_lcd(3, true, "Try: %u", core0_connection_attempt);
+    }
+}
+
+/** LCD page: Waiting for the actuators to retract */
+static void status_lcd_page_wait_retract(uint8_t index, uint64_t unix_time)
+{
+    (void)index;
+    (void)unix_time;
+    status_lcd(0, true, "UP: %s", fdelta(time_us_64() / 1000000ull, FBUF(0)));
+    status_lcd(1, true, "Waiting for");
+    status_lcd(2, true, "Actuator Retraction");
+    status_lcd(3, true, "");
+}
+
+static const struct status_lcd_page_group_t status_lcd_pages_wait_sync[] = { { status_lcd_page_wait_sync, 1 } };
+static const struct status_lcd_page_group_t status_lcd_pages_wait_retract[] = { { status_lcd_page_wait_retract, 1 } };
+
 void main_core1()
 {
     LOG("Started\n");
-    gpio_pull_up(SCHEDULE_SELECT_PIN);
+    /* Allow core 0 to pause this core while it writes to flash */
+    flash_safe_execute_core_init();
+#if SCHEDULE_PACKED_DECODE_BENCHMARK
+#define ZONE_BENCHMARK(level, ...) schedule_packed_benchmark("level " #level, &schedule_level_##level##_packed);
+    ZONE_TABLE(ZONE_BENCHMARK)
+#endif
 
 #ifdef WS2812_STATUS_GPIO
     LOG("Initializing ws2812 status led\n");
@@ -272,10 +810,23 @@ void main_core1()
     lcd_init();
     lcd_clear();
 
-    int schedule_num_selected = gpio_get(SCHEDULE_SELECT_PIN) ? 1 : 2;
+#if JOURNAL_ENABLE
+    LOG("Initializing journal\n");
+    journal_init();
+#endif
+
+    LOG("Initializing zones\n");
+    for (size_t i = 0; i < NUM_ZONES; i++)
+    {
+        zone_init(&zones[i], &zone_configs[i]);
+        LOG("Zone %s: %s\n", zones[i].conf.name, zones[i].enabled ? "Enabled" : "Disabled");
+    }
+
+#if WEAR_LOG_ENABLE
+    LOG("Initializing wear log\n");
+    wear_log_init(NUM_ACTUATORS);
+#endif
 
-    struct actuator_t act_on;
-    struct actuator_t act_off;
     LOG("Initializing actuators\n");
     {
         struct actuator_config_t cinfo = {};
@@ -283,34 +834,51 @@ void main_core1()
         cinfo.time_rest = ACTUATOR_REST_TIME;
         cinfo.logic_active_level_extend = ACTUATOR_ACTIVE_LOGIC_LEVEL_EXTEND;
         cinfo.logic_active_level_retract = ACTUATOR_ACTIVE_LOGIC_LEVEL_RETRACT;
+        cinfo.backend = ACTUATOR_BACKEND;
+        cinfo.time_stroke = ACTUATOR_STROKE_TIME;
+        cinfo.time_margin = ACTUATOR_POSITION_MARGIN;
 
-        cinfo.gpio_extend = ACTUATOR_GPIO_ACT_ON_EXTEND;
-        cinfo.gpio_retract = ACTUATOR_GPIO_ACT_ON_RETRACT;
-        actuator_init(&act_on, &cinfo);
-
-        cinfo.gpio_extend = ACTUATOR_GPIO_ACT_OFF_EXTEND;
-        cinfo.gpio_retract = ACTUATOR_GPIO_ACT_OFF_RETRACT;
-        actuator_init(&act_off, &cinfo);
+        for (size_t i = 0; i < NUM_ACTUATORS; i++)
+        {
+            cinfo.gpio_extend = actuator_gpios[i][0];
+            cinfo.gpio_retract = actuator_gpios[i][1];
+            cinfo.initial_position = -1;
+#if ACTUATOR_RETAIN_POSITION
+            cinfo.initial_position = retained_actuators_get(i);
+            if (cinfo.initial_position == 0)
+                LOG("Actuator %u: Retracted before reboot, skipping retract\n", (unsigned)i);
+#endif
+            if (!actuator_init(&actuators[i], &cinfo))
+            {
+                LOG("Actuator %u: Failed to initialize!\n", (unsigned)i);
+                die();
+            }
+            if (actuators[i].backend != cinfo.backend)
+                LOG("Actuator %u: Requested backend unavailable, using CPU\n", (unsigned)i);
+#if ACTUATOR_GROUP_EXCLUSIVE_ENERGIZE
+            /* Retract one actuator after the other */
+            if (actuator_in_cycle(&actuators[i]))
+                cinfo.time_init_delay = actuators[i].timestamp_end_retract + ACTUATOR_REST_TIME - time_us_64();
+#endif
+        }
+#if ACTUATOR_RETAIN_POSITION
+        /* Only valid again once the main loop sees every actuator idle */
+        retained_actuators.magic = 0;
+#endif
     }
 
     LOG("Waiting for SNTP sync\n");
     while (unix_time_get_last_sync() == 0)
     {
-        setup_status_lcd(1);
-        status_lcd(0, 0, true, "UP: %s", fdelta(time_us_64() / 1000000ull, FBUF(0)));
-        status_lcd(0, 1, true, "Waiting for");
-        if (core0_connected)
-        {
-            status_lcd(0, 2, true, "SNTP");
-            status_lcd(0, 3, true, "");
-        }
-        else
-        {
-            status_lcd(0, 2, true, "Network");
-            status_lcd(0, 3, true, "Try: %u", core0_connection_attempt);
-        }
-        actuator_poll(&act_on);
-        actuator_poll(&act_off);
+        status_lcd_render(status_lcd_pages_wait_sync, arraysize(status_lcd_pages_wait_sync), 0);
+        actuators_poll();
+        lcd_poll();
+#if WEAR_LOG_ENABLE
+        wear_log_update(actuators);
+#endif
+#if SCHEDULE_UPLOAD_ENABLE || WEAR_LOG_ENABLE
+        publish_next_event(false, 0);
+#endif
         minimal_status();
         sleep_ms(1);
 
@@ -319,15 +887,17 @@ void main_core1()
     }
 
     LOG("Waiting for actuators to retract\n");
-    while (actuator_in_cycle(&act_on) || actuator_in_cycle(&act_off))
+    while (actuators_in_cycle())
     {
-        setup_status_lcd(1);
-        status_lcd(0, 0, true, "UP: %s", fdelta(time_us_64() / 1000000ull, FBUF(0)));
-        status_lcd(0, 1, true, "Waiting for");
-        status_lcd(0, 2, true, "Actuator Retraction");
-        status_lcd(0, 3, true, "");
-        actuator_poll(&act_on);
-        actuator_poll(&act_off);
+        status_lcd_render(status_lcd_pages_wait_retract, arraysize(status_lcd_pages_wait_retract), 0);
+        actuators_poll();
+        lcd_poll();
+#if WEAR_LOG_ENABLE
+        wear_log_update(actuators);
+#endif
+#if SCHEDULE_UPLOAD_ENABLE || WEAR_LOG_ENABLE
+        publish_next_event(false, 0);
+#endif
         minimal_status();
         sleep_ms(1);
 
@@ -335,124 +905,114 @@ void main_core1()
             die();
     }
 
-    schedule_current_state_t state_level_1 = schedule_get_state(&schedule_level_1);
-    schedule_current_state_t state_level_2 = schedule_get_state(&schedule_level_2);
+    init_schedule_cursors();
+#if SCHEDULE_UPLOAD_ENABLE
+    schedule_upload_generation_applied = schedule_upload_generation;
+#endif
 
+    uint64_t unix_time = get_unix_time() / 1000000;
+    for (size_t i = 0; i < NUM_ZONES; i++)
+        zone_update(&zones[i], unix_time);
+
+#if JOURNAL_ENABLE
+    journal_sync_unix_time();
+#endif
     LOG("Commanding actuators to resume state (if so configured)\n");
-    if (state_level_1.on && state_level_1.allow_resume && schedule_num_selected == 1)
-    {
-        LOG("Resuming state 'ON' for level 1\n");
-        actuator_trigger(&act_on);
-    }
-    if (state_level_2.on && state_level_2.allow_resume && schedule_num_selected == 2)
+    for (size_t i = 0; i < NUM_ZONES; i++)
     {
-        LOG("Resuming state 'ON' for level 2\n");
-        actuator_trigger(&act_on);
-    }
-    if (!state_level_1.on && state_level_1.allow_resume && schedule_num_selected == 1)
-    {
-        LOG("Resuming state 'OFF' for level 1\n");
-        actuator_trigger(&act_off);
-    }
-    if (!state_level_2.on && state_level_2.allow_resume && schedule_num_selected == 2)
-    {
-        LOG("Resuming state 'OFF' for level 2\n");
-        actuator_trigger(&act_off);
+        if (zone_resume(&zones[i], actuators))
+        {
+            LOG("Resuming state '%s' for zone %s\n", zones[i].state.on ? "ON" : "OFF", zones[i].conf.name);
+#if JOURNAL_ENABLE
+            journal_record(JOURNAL_ZONE_RESUME, i, zones[i].state.on, 0, time_us_64());
+#endif
+        }
     }
 
+#if CORE1_TICKLESS
+    LOG("Claiming tickless alarm\n");
+    tickless_alarm = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(tickless_alarm, tickless_alarm_callback);
+#endif
+
     LOG("Resume on reset done, beginning loop\n");
     while (1)
     {
         minimal_status();
-        state_level_1 = schedule_get_state(&schedule_level_1);
-        state_level_2 = schedule_get_state(&schedule_level_2);
-
-        uint64_t unix_time = get_unix_time() / 1000000;
-
-        status("\n==> Schedule Status\n");
-        status("Level 1 enabled:      %d\n", schedule_num_selected == 1);
-        status("Level 1 state:        %d\n", state_level_1.on);
-        status("Level 1 in_region:    %d\n", state_level_1.in_region);
-        status("Level 1 allow_resume: %d\n", state_level_1.allow_resume);
-        status("Level 1 cur start:    %s (%s ago)\n", ftime(state_level_1.timestamp_region_start, FBUF(0)),
-            fdelta(unix_time - state_level_1.timestamp_region_start, FBUF(1)));
-        status("Level 1 next on:      %s (in %s)\n", ftime(state_level_1.timestamp_region_next_on, FBUF(0)),
-            fdelta(state_level_1.timestamp_region_next_on - unix_time, FBUF(1)));
-        status("Level 1 next off:     %s (in %s)\n", ftime(state_level_1.timestamp_region_next_off, FBUF(0)),
-            fdelta(state_level_1.timestamp_region_next_off - unix_time, FBUF(1)));
-
-        status("Level 2 enabled:      %d\n", schedule_num_selected == 2);
-        status("Level 2 state:        %d\n", state_level_2.on);
-        status("Level 2 in_region:    %d\n", state_level_2.in_region);
-        status("Level 2 allow_resume: %d\n", state_level_2.allow_resume);
-        status("Level 2 cur start:    %s (%s ago)\n", ftime(state_level_2.timestamp_region_start, FBUF(0)),
-            fdelta(unix_time - state_level_2.timestamp_region_start, FBUF(1)));
-        status("Level 2 next on:      %s (in %s)\n", ftime(state_level_2.timestamp_region_next_on, FBUF(0)),
-            fdelta(state_level_2.timestamp_region_next_on - unix_time, FBUF(1)));
-        status("Level 2 next off:     %s (in %s)\n", ftime(state_level_2.timestamp_region_next_off, FBUF(0)),
-            fdelta(state_level_2.timestamp_region_next_off - unix_time, FBUF(1)));
-
-        if (state_level_1.in_region && !(actuator_in_cycle(&act_on) || actuator_in_cycle(&act_off)) && schedule_num_selected == 1)
-        {
-            LOG("Level 1: %d\n", state_level_1.on);
-            actuator_trigger(state_level_1.on ? &act_on : &act_off);
-        }
-
-        if (state_level_2.in_region && !(actuator_in_cycle(&act_on) || actuator_in_cycle(&act_off)) && schedule_num_selected == 2)
+        unix_time = get_unix_time() / 1000000;
+#if JOURNAL_ENABLE
+        journal_sync_unix_time();
+#endif
+#if SCHEDULE_UPLOAD_ENABLE
+        if (schedule_upload_generation != schedule_upload_generation_applied)
         {
-            LOG("Level 2: %d\n", state_level_2.on);
-            actuator_trigger(state_level_2.on ? &act_on : &act_off);
+            const uint32_t generation = schedule_upload_generation;
+            LOG("New schedules uploaded, reloading\n");
+            init_schedule_cursors();
+            schedule_upload_generation_applied = generation;
         }
+#endif
 
-#define ACTV_IDLE(x) ((x) ? "ACTV" : "IDLE")
-#define RESUME_NO(x) ((x) ? "RES-Y" : "RES-N")
-#define ON_OFF(x) ((x) ? "ON " : "OFF")
+        /* Disabled zones only matter to status output and the automatic reboot check */
+        const bool reboot_due = time_us_64() / 1000000ull > AUTOMATIC_REBOOT_INTERVAL;
+        for (size_t i = 0; i < NUM_ZONES; i++)
+            if (zones[i].enabled || status_can_print || reboot_due)
+                zone_update(&zones[i], unix_time);
+#if SCHEDULE_UPLOAD_ENABLE || WEAR_LOG_ENABLE
+        publish_next_event(true, unix_time);
+#endif
 
-        setup_status_lcd(4);
-        status_lcd(0, 0, true, "%s", ftime(unix_time, FBUF(0)));
-        status_lcd(0, 1, true, "UP: %s", fdelta(time_us_64() / 1000000ull, FBUF(0)));
-        if (schedule_num_selected == 1)
-            status_lcd(0, 2, true, "L1: %s %s %s", ACTV_IDLE(state_level_1.in_region), RESUME_NO(state_level_1.allow_resume), ON_OFF(state_level_1.on));
-        else
-            status_lcd(0, 2, true, "L1: Disabled");
-        if (schedule_num_selected == 2)
-            status_lcd(0, 3, true, "L2: %s %s %s", ACTV_IDLE(state_level_2.in_region), RESUME_NO(state_level_2.allow_resume), ON_OFF(state_level_2.on));
-        else
-            status_lcd(0, 3, true, "L2: Disabled");
+        status_actuators();
+        status_zones(unix_time);
+        status_lcd_driver();
+        status_lcd_render(status_lcd_pages, arraysize(status_lcd_pages), unix_time);
+#if WEAR_LOG_ENABLE
+        status_wear();
+#endif
 
-        if (schedule_num_selected == 1)
-            status_lcd(1, 0, true, "L1: %s %s %s", ACTV_IDLE(state_level_1.in_region), RESUME_NO(state_level_1.allow_resume), ON_OFF(state_level_1.on));
-        else
-            status_lcd(1, 0, true, "L1: Disabled");
-        status_lcd(1, 1, true, "CUR:%s", ftime_compact(state_level_1.timestamp_region_start, FBUF(0)));
-        status_lcd(1, 2, true, "NON:%s", ftime_compact(state_level_1.timestamp_region_next_on, FBUF(0)));
-        status_lcd(1, 3, true, "NOF:%s", ftime_compact(state_level_1.timestamp_region_next_off, FBUF(0)));
+        for (size_t i = 0; i < NUM_ZONES; i++)
+        {
+            const uint64_t region = zones[i].region.timestamp_region_start;
+            const bool triggered = zone_poll(&zones[i], actuators, unix_time);
+#if JOURNAL_ENABLE
+            const struct zone_region_record_t* const r = &zones[i].region;
+            if (r->timestamp_region_start != region)
+                journal_record(JOURNAL_ZONE_REGION, i, r->on | r->held_off << 1, (uint32_t)r->timestamp_region_start, time_us_64());
+            if (triggered)
+                journal_record(JOURNAL_ZONE_TRIGGER, i, zones[i].command.on, 0, time_us_64());
+#else
+            (void)region;
+#endif
+            if (triggered)
+                LOG("Zone %s: %d\n", zones[i].conf.name, zones[i].command.on);
+        }
 
-        if (schedule_num_selected == 2)
-            status_lcd(2, 0, true, "L2: %s %s %s", ACTV_IDLE(state_level_2.in_region), RESUME_NO(state_level_2.allow_resume), ON_OFF(state_level_2.on));
-        else
-            status_lcd(2, 0, true, "L2: Disabled");
-        status_lcd(2, 1, true, "CUR:%s", ftime_compact(state_level_2.timestamp_region_start, FBUF(0)));
-        status_lcd(2, 2, true, "NON:%s", ftime_compact(state_level_2.timestamp_region_next_on, FBUF(0)));
-        status_lcd(2, 3, true, "NOF:%s", ftime_compact(state_level_2.timestamp_region_next_off, FBUF(0)));
-
-        status_lcd(3, 0, true, "%s", ftime(unix_time, FBUF(0)));
-        status_lcd(3, 1, true, "Schedule end dates");
-        status_lcd(3, 2, true, "L1: %s", ftime_compact(schedule_level_2.entries[schedule_level_2.num_entries - 1].timestamp + schedule_level_2.epoch, FBUF(0)));
-        status_lcd(3, 3, true, "L2: %s", ftime_compact(schedule_level_2.entries[schedule_level_2.num_entries - 1].timestamp + schedule_level_2.epoch, FBUF(0)));
-
-        if (time_us_64() / 1000000ull > AUTOMATIC_REBOOT_INTERVAL //
-            && !state_level_1.in_region //
-            && !state_level_2.in_region //
-            && !actuator_in_cycle(&act_on) && !actuator_in_cycle(&act_off) //
-            && state_level_1.timestamp_region_next_on - unix_time > AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION
-            && state_level_2.timestamp_region_next_on - unix_time > AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION
-            && state_level_1.timestamp_region_next_off - unix_time > AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION
-            && state_level_2.timestamp_region_next_off - unix_time > AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION)
-            die();
+        if (reboot_due && !actuators_in_cycle())
+        {
+            bool reboot = true;
+            for (size_t i = 0; i < NUM_ZONES; i++)
+            {
+                const schedule_current_state_t* const s = &zones[i].state;
+                if (s->in_region || zones[i].command.pending //
+                    || s->timestamp_region_next_on - unix_time <= AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION
+                    || s->timestamp_region_next_off - unix_time <= AUTOMATIC_REBOOT_MIN_DISTANCE_TO_REGION)
+                    reboot = false;
+            }
+            if (reboot)
+                die();
+        }
 
-        actuator_poll(&act_on);
-        actuator_poll(&act_off);
+        actuators_poll();
+        lcd_poll();
+#if ACTUATOR_RETAIN_POSITION
+        retained_actuators_save();
+#endif
+#if WEAR_LOG_ENABLE
+        wear_log_update(actuators);
+#endif
+#if CORE1_TICKLESS
+        tickless_sleep_until(tickless_next_deadline(get_unix_time()));
+#endif
         loop_measure_end_loop(&core1_loop_measure);
     }
 }
@@ -0,0 +1,138 @@
+#!/bin/python3
+# SPDX-License-Identifier: MIT
+#
+# SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+# Builds a schedule partition slot image (see schedule_partition.h) from the schedules in generate_schedules.py
+#
+# The image is written both as a raw binary (which can be sent with upload_schedule.py) and as a UF2 that can be loaded
+# with upload_to_pico.sh
+import generate_schedules
+import struct
+import zlib
+
+SCHEDULE_PARTITION_MAGIC = 0x53534C50
+SCHEDULE_PARTITION_VERSION = 1
+
+HEADER_FORMAT = "<IIIIII8x"
+ENTRY_FORMAT = "<QIIII"
+
+UF2_MAGIC_START0 = 0x0A324655
+UF2_MAGIC_START1 = 0x9E5D5157
+UF2_MAGIC_END = 0x0AB16F30
+UF2_FLAG_FAMILY_ID_PRESENT = 0x00002000
+UF2_FAMILY_ID_ABSOLUTE = 0xE48BFF57
+UF2_PAYLOAD_SIZE = 256
+
+XIP_BASE = 0x10000000
+
+
+def build_partition(schedules: list[list[tuple[int, bool]]], sequence: int = 0) -> bytes:
+    """ Returns the slot image for a list of sorted schedules """
+    header_size = struct.calcsize(HEADER_FORMAT)
+    entries_size = struct.calcsize(ENTRY_FORMAT) * len(schedules)
+
+    entries = b""
+    data = b""
+    for sched in schedules:
+        epoch, resolution, packed = generate_schedules.pack_schedule(sched)
+        offset = header_size + entries_size + len(data)
+        entries += struct.pack(ENTRY_FORMAT, epoch, resolution, len(sched), offset, len(packed))
+        data += packed
+
+    payload = entries + data
+    header = struct.pack(HEADER_FORMAT, SCHEDULE_PARTITION_MAGIC, SCHEDULE_PARTITION_VERSION, len(payload), zlib.crc32(payload), len(schedules), sequence)
+    return header + payload
+
+
+def to_uf2(image: bytes, address: int, family_id: int) -> bytes:
+    """ Returns image as UF2 blocks starting at address """
+    if len(image) % UF2_PAYLOAD_SIZE:
+        image += b"\xff" * (UF2_PAYLOAD_SIZE - len(image) % UF2_PAYLOAD_SIZE)
+    num_blocks = len(image) // UF2_PAYLOAD_SIZE
+    out = b""
+    for i in range(num_blocks):
+        chunk = image[i * UF2_PAYLOAD_SIZE:(i + 1) * UF2_PAYLOAD_SIZE]
+        out += struct.pack("<IIIIIIII", UF2_MAGIC_START0, UF2_MAGIC_START1, UF2_FLAG_FAMILY_ID_PRESENT,
+                           address + i * UF2_PAYLOAD_SIZE, UF2_PAYLOAD_SIZE, i, num_blocks, family_id)
+        out += chunk + b"\x00" * (476 - len(chunk))
+        out += struct.pack("<I", UF2_MAGIC_END)
+    return out
+
+
+if __name__ == "__main__":
+    import argparse
+    parser = argparse.ArgumentParser(description="Build a schedule partition image from the schedules in generate_schedules.py")
+    parser.add_argument("--flash-size",
+                        default=16 * 1024 * 1024,
+                        metavar="BYTES",
+                        help="Flash size, must match PICO_FLASH_SIZE_BYTES (default 16MiB)",
+                        type=lambda x: int(x, 0))
+    parser.add_argument("--size",
+                        default=64 * 1024,
+                        metavar="BYTES",
+                        help="Partition size, must match SCHEDULE_PARTITION_SIZE (default 64KiB)",
+                        type=lambda x: int(x, 0))
+    parser.add_argument("--offset",
+                        default=None,
+                        metavar="BYTES",
+                        help="Partition offset from the start of flash, must match SCHEDULE_PARTITION_OFFSET (default flash size - partition size)",
+                        type=lambda x: int(x, 0))
+    parser.add_argument("--num-slots",
+                        default=2,
+                        metavar="N",
+                        help="Number of slots in the partition, must match SCHEDULE_PARTITION_NUM_SLOTS (default 2)",
+                        type=int)
+    parser.add_argument("--slot", default=0, metavar="N", help="Slot to place the UF2 image in (default 0)", type=int)
+    parser.add_argument("--sequence",
+                        default=0,
+                        metavar="N",
+                        help="Sequence number of the image, the valid slot with the highest one is used (default 0)",
+                        type=int)
+    parser.add_argument("--family-id",
+                        default=UF2_FAMILY_ID_ABSOLUTE,
+                        metavar="ID",
+                        help="UF2 family ID (default 0x%08x, absolute)" % UF2_FAMILY_ID_ABSOLUTE,
+                        type=lambda x: int(x, 0))
+    parser.add_argument("output", nargs="?", default="schedule_partition", help="Output name, without extension (default schedule_partition)")
+    args = parser.parse_args()
+
+    offset = args.offset if args.offset is not None else args.flash_size - args.size
+    slot_size = args.size // args.num_slots
+    if not 0 <= args.slot < args.num_slots:
+        raise SystemExit(f"Slot {args.slot} does not exist, there are {args.num_slots} slots")
+    offset += args.slot * slot_size
+
+    g = generate_schedules
+    image = build_partition([
+        g.generate_schedule(g.time_on_level_1, g.time_off_soft_level_1, g.time_off_level_1),
+        g.generate_schedule(g.time_on_level_2, g.time_off_soft_level_2, g.time_off_level_2),
+    ], args.sequence)
+
+    if len(image) > slot_size:
+        raise SystemExit(f"Slot image is {len(image)} bytes, which does not fit in {slot_size} bytes")
+
+    with open(f"{args.output}.bin", "wb") as fd:
+        fd.write(image)
+    with open(f"{args.output}.uf2", "wb") as fd:
+        fd.write(to_uf2(image, XIP_BASE + offset, args.family_id))
+
+    print(f"Wrote {args.output}.bin and {args.output}.uf2: {len(image)} bytes @ 0x{XIP_BASE + offset:08x}")
@@ -0,0 +1,234 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Schedule evaluation (Implementation)
+ */
+
+#include "schedule.h"
+#include "schedule_packed.h"
+#include "schedule_rules.h"
+
+#include "config.h"
+
+#include <stddef.h> /* NULL */
+#include <string.h> /* memset() */
+
+static inline void schedule_fill_past_entry(schedule_current_state_t* const r, const uint64_t epoch, const schedule_entry_t* const e, const int64_t epoch_time)
+{
+    r->on = e->on;
+    r->allow_resume = e->allow_resume && (r->on ? SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_ON_REGION : SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_OFF_REGION);
+    r->timestamp_region_start = (uint64_t)(e->timestamp) + epoch;
+    if (epoch_time < (int64_t)(e->timestamp + SCHEDULE_TRIGGER_REGION_LENGTH))
+        r->in_region = 1;
+}
+
+schedule_current_state_t schedule_get_state_scan(const schedule_t* const schedule, const int64_t unix_time)
+{
+    const int64_t epoch_time = unix_time - (int64_t)schedule->epoch;
+
+    schedule_current_state_t r = { 0 };
+    r.timestamp_region_next_off = UINT64_MAX;
+    r.timestamp_region_next_on = UINT64_MAX;
+
+    for (uint32_t i = 0; i < schedule->num_entries; i++)
+    {
+        if (schedule->entries[i].timestamp < epoch_time)
+            schedule_fill_past_entry(&r, schedule->epoch, &schedule->entries[i], epoch_time);
+        else
+        {
+            if (schedule->entries[i].on)
+            {
+                if (r.timestamp_region_next_on == UINT64_MAX)
+                    r.timestamp_region_next_on = (uint64_t)(schedule->entries[i].timestamp) + schedule->epoch;
+            }
+            else
+            {
+                if (r.timestamp_region_next_off == UINT64_MAX)
+                    r.timestamp_region_next_off = (uint64_t)(schedule->entries[i].timestamp) + schedule->epoch;
+            }
+        }
+    }
+
+    return r;
+}
+
+/** Find the index of the first entry that is not before epoch_time */
+static uint32_t schedule_lower_bound(const schedule_t* const schedule, const int64_t epoch_time)
+{
+    uint32_t lo = 0;
+    uint32_t hi = schedule->num_entries;
+    while (lo < hi)
+    {
+        const uint32_t mid = lo + (hi - lo) / 2;
+        if (schedule->entries[mid].timestamp < epoch_time)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/** Build the state of a schedule from the index of the first entry that is not before epoch_time */
+static schedule_current_state_t schedule_state_from_pos(const schedule_t* const schedule, const uint32_t pos, const int64_t epoch_time)
+{
+    schedule_current_state_t r = { 0 };
+    r.timestamp_region_next_off = UINT64_MAX;
+    r.timestamp_region_next_on = UINT64_MAX;
+
+    /* Entries are sorted, so the last entry before epoch_time is the only one that can place us in a region */
+    if (pos > 0)
+        schedule_fill_past_entry(&r, schedule->epoch, &schedule->entries[pos - 1], epoch_time);
+
+    const uint32_t next_on = schedule->next_on[pos];
+    const uint32_t next_off = schedule->next_off[pos];
+    if (next_on < schedule->num_entries)
+        r.timestamp_region_next_on = (uint64_t)(schedule->entries[next_on].timestamp) + schedule->epoch;
+    if (next_off < schedule->num_entries)
+        r.timestamp_region_next_off = (uint64_t)(schedule->entries[next_off].timestamp) + schedule->epoch;
+
+    return r;
+}
+
+schedule_current_state_t schedule_get_state(const schedule_t* const schedule, const int64_t unix_time)
+{
+    const int64_t epoch_time = unix_time - (int64_t)schedule->epoch;
+    return schedule_state_from_pos(schedule, schedule_lower_bound(schedule, epoch_time), epoch_time);
+}
+
+void schedule_cursor_init(schedule_cursor_t* const c, const schedule_t* const schedule)
+{
+    memset(c, 0, sizeof(*c));
+    c->schedule = schedule;
+    c->end = UINT64_MAX;
+    if (schedule->num_entries)
+        c->end = (uint64_t)(schedule->entries[schedule->num_entries - 1].timestamp) + schedule->epoch;
+    c->cached_time = INT64_MAX;
+}
+
+void schedule_cursor_init_rules(schedule_cursor_t* const c, const struct schedule_rules_t* const rules)
+{
+    memset(c, 0, sizeof(*c));
+    c->rules = rules;
+    c->end = UINT64_MAX;
+    c->cached_time = INT64_MAX;
+}
+
+void schedule_cursor_init_packed(schedule_cursor_t* const c, const struct schedule_packed_t* const packed)
+{
+    memset(c, 0, sizeof(*c));
+    c->packed = packed;
+    c->end = UINT64_MAX;
+    c->cached_time = INT64_MAX;
+
+    schedule_packed_reader_t it;
+    schedule_packed_reader_init(&it, packed);
+    schedule_entry_t e;
+    while (schedule_packed_reader_next(&it, &e))
+        c->end = (uint64_t)(e.timestamp) + packed->epoch;
+}
+
+uint64_t schedule_cursor_get_end(const schedule_cursor_t* const c) { return c->end; }
+
+/** Check if the cached result of a rule or packed schedule cursor is still valid */
+static bool schedule_cursor_cache_valid(const schedule_cursor_t* const c, const int64_t unix_time)
+{
+    const schedule_current_state_t* const s = &c->cached_state;
+    if (unix_time < c->cached_time)
+        return false;
+    if ((uint64_t)unix_time > s->timestamp_region_next_on || (uint64_t)unix_time > s->timestamp_region_next_off)
+        return false;
+    if (s->in_region && unix_time >= (int64_t)(s->timestamp_region_start + SCHEDULE_TRIGGER_REGION_LENGTH))
+        return false;
+    return true;
+}
+
+/** Decode a packed schedule forward from the position of a cursor */
+static schedule_current_state_t schedule_cursor_get_state_packed(schedule_cursor_t* const c, const int64_t unix_time)
+{
+    const schedule_packed_t* const packed = c->packed;
+    const int64_t epoch_time = unix_time - (int64_t)packed->epoch;
+
+    if (unix_time < c->cached_time)
+    {
+        /* Clock stepped backwards, restart from the first entry */
+        c->pos = 0;
+        c->offset = 0;
+        memset(&c->prev, 0, sizeof(c->prev));
+    }
+
+    schedule_packed_reader_t pos = { packed, c->offset, c->pos, c->prev.timestamp };
+    schedule_packed_reader_t it = pos;
+    schedule_entry_t e;
+    while (schedule_packed_reader_next(&it, &e) && e.timestamp < epoch_time)
+    {
+        c->prev = e;
+        pos = it;
+    }
+    c->pos = pos.index;
+    c->offset = pos.offset;
+
+    schedule_current_state_t r = { 0 };
+    r.timestamp_region_next_off = UINT64_MAX;
+    r.timestamp_region_next_on = UINT64_MAX;
+
+    if (c->pos > 0)
+        schedule_fill_past_entry(&r, packed->epoch, &c->prev, epoch_time);
+
+    it = pos;
+    while ((r.timestamp_region_next_on == UINT64_MAX || r.timestamp_region_next_off == UINT64_MAX) && schedule_packed_reader_next(&it, &e))
+    {
+        if (e.on && r.timestamp_region_next_on == UINT64_MAX)
+            r.timestamp_region_next_on = (uint64_t)(e.timestamp) + packed->epoch;
+        if (!e.on && r.timestamp_region_next_off == UINT64_MAX)
+            r.timestamp_region_next_off = (uint64_t)(e.timestamp) + packed->epoch;
+    }
+
+    return r;
+}
+
+schedule_current_state_t schedule_cursor_get_state(schedule_cursor_t* const c, const int64_t unix_time)
+{
+    if (c->rules || c->packed)
+    {
+        if (!schedule_cursor_cache_valid(c, unix_time))
+            c->cached_state = c->rules ? schedule_rules_get_state(c->rules, unix_time) : schedule_cursor_get_state_packed(c, unix_time);
+        c->cached_time = unix_time;
+        return c->cached_state;
+    }
+
+    const schedule_t* const schedule = c->schedule;
+    const int64_t epoch_time = unix_time - (int64_t)schedule->epoch;
+
+    const bool after_prev = c->pos == 0 || schedule->entries[c->pos - 1].timestamp < epoch_time;
+    const bool before_next = c->pos == schedule->num_entries || !(schedule->entries[c->pos].timestamp < epoch_time);
+    if (!after_prev || !before_next)
+        c->pos = schedule_lower_bound(schedule, epoch_time);
+
+    return schedule_state_from_pos(schedule, c->pos, epoch_time);
+}
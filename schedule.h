@@ -0,0 +1,179 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Schedule struct definitions and schedule evaluation
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct
+{
+    /** Seconds since schedule_t::epoch */
+    uint32_t timestamp : 30;
+    /** Schedule state */
+    bool on : 1;
+    /** Allow actuators to resume state from reboot */
+    bool allow_resume : 1;
+} schedule_entry_t;
+
+/**
+ * A sorted list of schedule entries and their successor index tables
+ *
+ * The index tables are generated by generate_schedules.py, each has schedule_t::num_entries + 1 elements,
+ * with schedule_t::num_entries being used as the "no such entry" marker
+ */
+typedef struct
+{
+    /** Seconds between 1970 and the first entry */
+    uint64_t epoch;
+    uint32_t num_entries;
+    const schedule_entry_t* entries;
+    /** Index of the first "ON" entry at or after each index */
+    const uint32_t* next_on;
+    /** Index of the first "OFF" entry at or after each index */
+    const uint32_t* next_off;
+    /** Index of the first entry after each index whose state differs from the entry at that index */
+    const uint32_t* region_end;
+} schedule_t;
+
+typedef struct
+{
+    bool on;
+    bool allow_resume;
+    bool in_region;
+
+    /** Starting Timestamp (in seconds since 1970-01-01) of current region */
+    uint64_t timestamp_region_start;
+    /** Timestamp (in seconds since 1970-01-01) of the next "OFF" region */
+    uint64_t timestamp_region_next_off;
+    /** Timestamp (in seconds since 1970-01-01) of the next "ON" region */
+    uint64_t timestamp_region_next_on;
+} schedule_current_state_t;
+
+/* Definition in schedule_rules.h */
+struct schedule_rules_t;
+/* Definition in schedule_packed.h */
+struct schedule_packed_t;
+
+/**
+ * Cached schedule evaluator
+ *
+ * A cursor evaluates either a table schedule (schedule_t), a rule schedule (schedule_rules_t)
+ * or a packed schedule (schedule_packed_t).
+ *
+ * Remembers the position of the last evaluation so that steady state evaluation is O(1),
+ * any other time (eg. crossing an entry or a clock step from SNTP) the cursor re-seeks.
+ */
+typedef struct
+{
+    /** Table schedule to evaluate (NULL for other schedules) */
+    const schedule_t* schedule;
+    /** Rule schedule to evaluate (NULL for other schedules) */
+    const struct schedule_rules_t* rules;
+    /** Packed schedule to evaluate (NULL for other schedules) */
+    const struct schedule_packed_t* packed;
+    /** Timestamp (in seconds since 1970-01-01) of the last entry, or UINT64_MAX if the schedule has no end */
+    uint64_t end;
+    /** Index of the first entry that is not before the time of the last evaluation (table and packed schedules only) */
+    uint32_t pos;
+    /** Byte offset of entry schedule_cursor_t::pos (packed schedules only) */
+    uint32_t offset;
+    /** Entry before schedule_cursor_t::pos (packed schedules only) */
+    schedule_entry_t prev;
+    /** Time (in seconds since 1970-01-01) of the last evaluation (rule and packed schedules only) */
+    int64_t cached_time;
+    /** Result of the last evaluation (rule and packed schedules only) */
+    schedule_current_state_t cached_state;
+} schedule_cursor_t;
+
+/**
+ * Evaluate a schedule by scanning every entry
+ *
+ * This is the reference implementation that schedule_get_state() and schedule_cursor_get_state() must match
+ *
+ * @param schedule Schedule to evaluate
+ * @param unix_time Time (in seconds since 1970-01-01) to evaluate the schedule at
+ */
+schedule_current_state_t schedule_get_state_scan(const schedule_t* const schedule, const int64_t unix_time);
+
+/**
+ * Evaluate a schedule with a binary search over the entries and the successor index tables
+ *
+ * @param schedule Schedule to evaluate
+ * @param unix_time Time (in seconds since 1970-01-01) to evaluate the schedule at
+ */
+schedule_current_state_t schedule_get_state(const schedule_t* const schedule, const int64_t unix_time);
+
+/**
+ * Initialize a schedule cursor for a table schedule
+ *
+ * @param c Cursor to initialize
+ * @param schedule Schedule to attach the cursor to
+ */
+void schedule_cursor_init(schedule_cursor_t* const c, const schedule_t* const schedule);
+
+/**
+ * Initialize a schedule cursor for a rule schedule
+ *
+ * @param c Cursor to initialize
+ * @param rules Rules to attach the cursor to
+ */
+void schedule_cursor_init_rules(schedule_cursor_t* const c, const struct schedule_rules_t* const rules);
+
+/**
+ * Initialize a schedule cursor for a packed schedule
+ *
+ * NOTE: This decodes the whole schedule once to find its end
+ *
+ * @param c Cursor to initialize
+ * @param packed Packed schedule to attach the cursor to
+ */
+void schedule_cursor_init_packed(schedule_cursor_t* const c, const struct schedule_packed_t* const packed);
+
+/**
+ * Get the time of the last entry of the schedule attached to a cursor
+ *
+ * @returns Timestamp (in seconds since 1970-01-01), or UINT64_MAX if the schedule has no end
+ */
+uint64_t schedule_cursor_get_end(const schedule_cursor_t* const c);
+
+/**
+ * Evaluate a schedule from a cursor
+ *
+ * For table schedules: O(1) while the time stays between the same two entries, O(log n) otherwise
+ * For rule schedules: O(1) while the result does not change, see schedule_rules_get_state() otherwise
+ * For packed schedules: O(1) while the result does not change, otherwise decodes forward from the last position
+ *                       (from the start if time moves backwards) until the next "ON" and "OFF" entries are found
+ *
+ * @param c Cursor to evaluate and update
+ * @param unix_time Time (in seconds since 1970-01-01) to evaluate the schedule at
+ */
+schedule_current_state_t schedule_cursor_get_state(schedule_cursor_t* const c, const int64_t unix_time);
@@ -0,0 +1,622 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Schedule lookup microbenchmark
+ *
+ * Measures every schedule evaluation strategy against the built-in schedules and against synthetic table schedules
+ * of increasing size. Builds on the host (see host/CMakeLists.txt) and, with SCHEDULE_BENCH=ON, on the RP2350.
+ *
+ * Access patterns:
+ * - loop:     Small forward steps like the control loop on core 1 (1 second, or longer to sweep large schedules in
+ *             2^20 lookups), wrapping around at the end
+ * - random:   Uniformly distributed times over the whole schedule (Defeats caches and cursors)
+ * - boundary: Walks across region boundaries (entry time -1, +0, +1, end of trigger region), timing every lookup on
+ *             its own to find the worst case
+ *
+ * Every strategy is also checked against schedule_get_state() (or the reference scan on small tables)
+ */
+#include "schedule.h"
+#include "schedule_packed.h"
+#include "schedule_rules.h"
+
+#include "config.h"
+
+#include "schedule_level_1.h"
+#include "schedule_level_1_packed.h"
+#include "schedule_level_1_rules.h"
+#include "schedule_level_2.h"
+#include "schedule_level_2_packed.h"
+#include "schedule_level_2_rules.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if PICO_ON_DEVICE
+#include "pico/stdlib.h"
+
+/** Largest synthetic table (16 bytes per entry for the table and index tables) */
+#define SCHEDULE_BENCH_MAX_ENTRIES (16u * 1024u)
+/** Minimum measurement time of every strategy/pattern combination */
+#define SCHEDULE_BENCH_BUDGET_NS (200ull * 1000ull * 1000ull)
+#else
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define SCHEDULE_BENCH_MAX_ENTRIES (1024u * 1024u)
+#define SCHEDULE_BENCH_BUDGET_NS (50ull * 1000ull * 1000ull)
+#endif
+
+/** Number of boundaries walked by the boundary pattern */
+#define SCHEDULE_BENCH_BOUNDARIES 256
+
+/** Seconds between the two entries of a synthetic ON/OFF pair */
+#define SYNTHETIC_PAIR_LENGTH 300
+/** Seconds between synthetic ON/OFF pairs, keeps 1M entries within the 30 bit schedule_entry_t::timestamp */
+#define SYNTHETIC_PAIR_PERIOD 1800
+/** Resolution of synthetic packed schedules */
+#define SYNTHETIC_PACKED_RESOLUTION 60
+
+/* ================================ Timing/Counters ================================ */
+
+static uint64_t bench_now_ns(void)
+{
+#if PICO_ON_DEVICE
+    return time_us_64() * 1000ull;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/** Cache miss counters, only available on Linux (and only if perf_event_open() is permitted) */
+static struct
+{
+    int fd_l1d;
+    int fd_llc;
+} bench_counters = { -1, -1 };
+
+#if defined(__linux__) && !PICO_ON_DEVICE
+static int bench_counter_open(const uint32_t type, const uint64_t config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void bench_counters_init(void)
+{
+    bench_counters.fd_l1d = bench_counter_open(PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+    bench_counters.fd_llc = bench_counter_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+}
+
+static void bench_counter_start(const int fd)
+{
+    if (fd < 0)
+        return;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+/** @returns Counter value, or -1 if the counter is unavailable */
+static int64_t bench_counter_stop(const int fd)
+{
+    if (fd < 0)
+        return -1;
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    uint64_t value = 0;
+    if (read(fd, &value, sizeof(value)) != sizeof(value))
+        return -1;
+    return (int64_t)value;
+}
+#else
+static void bench_counters_init(void) { }
+static void bench_counter_start(const int fd) { (void)fd; }
+static int64_t bench_counter_stop(const int fd)
+{
+    (void)fd;
+    return -1;
+}
+#endif
+
+/** xorshift64, the C library rand() is too slow and too short on some platforms */
+static uint64_t bench_rand_state = 0x9E3779B97F4A7C15ull;
+static uint64_t bench_rand(void)
+{
+    bench_rand_state ^= bench_rand_state << 13;
+    bench_rand_state ^= bench_rand_state >> 7;
+    bench_rand_state ^= bench_rand_state << 17;
+    return bench_rand_state;
+}
+
+/* ================================ Schedules ================================ */
+
+/** A schedule in every representation that is benchmarked */
+struct bench_schedule_t
+{
+    const char* name;
+    /** Table representation, always present */
+    const schedule_t* table;
+    /** Packed representation (NULL if unavailable) */
+    const schedule_packed_t* packed;
+    /** Rule representation (NULL if unavailable) */
+    const schedule_rules_t* rules;
+    /** Bytes occupied by the entries and index tables */
+    size_t table_bytes;
+};
+
+/** Storage of a synthetic schedule */
+struct bench_synthetic_t
+{
+    schedule_t table;
+    schedule_packed_t packed;
+    schedule_entry_t* entries;
+    uint32_t* indices;
+    uint8_t* packed_data;
+};
+
+static void bench_synthetic_free(struct bench_synthetic_t* const s)
+{
+    free(s->entries);
+    free(s->indices);
+    free(s->packed_data);
+    memset(s, 0, sizeof(*s));
+}
+
+/**
+ * Generate a synthetic schedule of ON/OFF pairs (and an extra OFF entry every 7th pair)
+ *
+ * Index tables are built the same way as successor_indices() in generate_schedules.py
+ *
+ * @returns True on success, False if out of memory
+ */
+static bool bench_synthetic_init(struct bench_synthetic_t* const s, const uint32_t num_entries)
+{
+    memset(s, 0, sizeof(*s));
+    const uint32_t n = num_entries;
+    s->entries = malloc(sizeof(*s->entries) * n);
+    s->indices = malloc(sizeof(*s->indices) * (n + 1) * 3);
+    /* Worst case of 5 bytes per varint */
+    s->packed_data = malloc((size_t)n * 5);
+    if (!s->entries || !s->indices || !s->packed_data)
+    {
+        bench_synthetic_free(s);
+        return false;
+    }
+
+    uint32_t timestamp = 0;
+    for (uint32_t i = 0, pair = 0; i < n; pair++)
+    {
+        timestamp = pair * SYNTHETIC_PAIR_PERIOD;
+        s->entries[i++] = (schedule_entry_t) { timestamp, 1, pair & 1 };
+        if (i < n)
+            s->entries[i++] = (schedule_entry_t) { timestamp + SYNTHETIC_PAIR_LENGTH, 0, 1 };
+        if (i < n && pair % 7 == 6)
+            s->entries[i++] = (schedule_entry_t) { timestamp + SYNTHETIC_PAIR_LENGTH * 2, 0, 0 };
+    }
+
+    uint32_t* const next_on = s->indices;
+    uint32_t* const next_off = s->indices + (n + 1);
+    uint32_t* const region_end = s->indices + (n + 1) * 2;
+    next_on[n] = n;
+    next_off[n] = n;
+    region_end[n] = n;
+    for (uint32_t i = n; i-- > 0;)
+    {
+        next_on[i] = s->entries[i].on ? i : next_on[i + 1];
+        next_off[i] = s->entries[i].on ? next_off[i + 1] : i;
+        region_end[i] = s->entries[i].on ? next_off[i + 1] : next_on[i + 1];
+    }
+
+    uint32_t size = 0;
+    uint32_t prev = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        uint32_t value = ((s->entries[i].timestamp - prev) / SYNTHETIC_PACKED_RESOLUTION) << 2;
+        value |= (uint32_t)(s->entries[i].on) << 1 | s->entries[i].allow_resume;
+        prev = s->entries[i].timestamp;
+        do
+        {
+            s->packed_data[size++] = (value & 0x7F) | (value > 0x7F ? 0x80 : 0);
+            value >>= 7;
+        } while (value);
+    }
+
+    /* Roughly the time of the built-in schedules */
+    const uint64_t epoch = 1745939100ull;
+    s->table = (schedule_t) { epoch, n, s->entries, next_on, next_off, region_end };
+    s->packed = (schedule_packed_t) { epoch, SYNTHETIC_PACKED_RESOLUTION, n, size, s->packed_data };
+    return true;
+}
+
+/* ================================ Strategies ================================ */
+
+enum bench_strategy_t
+{
+    BENCH_SCAN,
+    BENCH_BINARY_SEARCH,
+    BENCH_CURSOR_TABLE,
+    BENCH_CURSOR_PACKED,
+    BENCH_RULES,
+    BENCH_CURSOR_RULES,
+    BENCH_STRATEGY_COUNT,
+};
+
+static const char* const bench_strategy_names[BENCH_STRATEGY_COUNT] = {
+    "scan",
+    "binary-search",
+    "cursor-table",
+    "cursor-packed",
+    "rules",
+    "cursor-rules",
+};
+
+enum bench_pattern_t
+{
+    BENCH_LOOP,
+    BENCH_RANDOM,
+    BENCH_BOUNDARY,
+    BENCH_PATTERN_COUNT,
+};
+
+static const char* const bench_pattern_names[BENCH_PATTERN_COUNT] = {
+    "loop",
+    "random",
+    "boundary",
+};
+
+struct bench_ctx_t
+{
+    const struct bench_schedule_t* s;
+    enum bench_strategy_t strategy;
+    schedule_cursor_t cursor;
+    /** First and last time (in seconds since 1970-01-01) of the lookups */
+    int64_t first;
+    int64_t last;
+};
+
+static bool bench_strategy_available(const struct bench_schedule_t* const s, const enum bench_strategy_t strategy)
+{
+    switch (strategy)
+    {
+    case BENCH_CURSOR_PACKED:
+        return s->packed;
+    case BENCH_RULES:
+    case BENCH_CURSOR_RULES:
+        return s->rules;
+    default:
+        return true;
+    }
+}
+
+static void bench_ctx_init(struct bench_ctx_t* const ctx, const struct bench_schedule_t* const s, const enum bench_strategy_t strategy)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->s = s;
+    ctx->strategy = strategy;
+    if (strategy == BENCH_CURSOR_TABLE)
+        schedule_cursor_init(&ctx->cursor, s->table);
+    else if (strategy == BENCH_CURSOR_PACKED)
+        schedule_cursor_init_packed(&ctx->cursor, s->packed);
+    else if (strategy == BENCH_CURSOR_RULES)
+        schedule_cursor_init_rules(&ctx->cursor, s->rules);
+
+    /* One day either side of the table, so the edges of the schedule are covered too */
+    const schedule_t* const t = ctx->s->table;
+    ctx->first = (int64_t)t->epoch - SCHEDULE_RULES_SECONDS_PER_DAY;
+    ctx->last = (int64_t)t->epoch + SCHEDULE_RULES_SECONDS_PER_DAY;
+    if (t->num_entries)
+        ctx->last += t->entries[t->num_entries - 1].timestamp;
+}
+
+static schedule_current_state_t bench_lookup(struct bench_ctx_t* const ctx, const int64_t unix_time)
+{
+    switch (ctx->strategy)
+    {
+    case BENCH_SCAN:
+        return schedule_get_state_scan(ctx->s->table, unix_time);
+    case BENCH_BINARY_SEARCH:
+        return schedule_get_state(ctx->s->table, unix_time);
+    case BENCH_RULES:
+        return schedule_rules_get_state(ctx->s->rules, unix_time);
+    default:
+        return schedule_cursor_get_state(&ctx->cursor, unix_time);
+    }
+}
+
+/** Results of one strategy/pattern combination */
+struct bench_result_t
+{
+    uint64_t lookups;
+    double ns_per_lookup;
+    /** Slowest single lookup (boundary pattern only) */
+    uint64_t max_ns;
+    /** Cache misses per lookup (negative if unavailable) */
+    double l1d_misses;
+    double llc_misses;
+    /** Lookups that disagreed with the reference */
+    uint32_t mismatches;
+};
+
+/** Time (in seconds since 1970-01-01) of the i-th boundary lookup */
+static int64_t bench_boundary_time(const struct bench_ctx_t* const ctx, const uint32_t i)
+{
+    static const int64_t offsets[] = { -1, 0, 1, SCHEDULE_TRIGGER_REGION_LENGTH - 1, SCHEDULE_TRIGGER_REGION_LENGTH, SCHEDULE_TRIGGER_REGION_LENGTH + 1 };
+    const uint32_t num_offsets = sizeof(offsets) / sizeof(*offsets);
+    const schedule_t* const t = ctx->s->table;
+    if (!t->num_entries)
+        return ctx->first + i;
+    /* Boundaries spread evenly in increasing order, so cursors move forward like they do in the control loop */
+    const uint64_t entry = (uint64_t)(i / num_offsets % SCHEDULE_BENCH_BOUNDARIES) * t->num_entries / SCHEDULE_BENCH_BOUNDARIES;
+    return (int64_t)(t->epoch + t->entries[entry].timestamp) + offsets[i % num_offsets];
+}
+
+static int64_t bench_pattern_time(const struct bench_ctx_t* const ctx, const enum bench_pattern_t pattern, const uint64_t i)
+{
+    const uint64_t span = (uint64_t)(ctx->last - ctx->first) + 1;
+    switch (pattern)
+    {
+    case BENCH_LOOP:
+    {
+        const uint64_t step = span >> 20 ? span >> 20 : 1;
+        return ctx->first + (int64_t)((i * step) % span);
+    }
+    case BENCH_RANDOM:
+        return ctx->first + (int64_t)(bench_rand() % span);
+    default:
+        return bench_boundary_time(ctx, (uint32_t)i);
+    }
+}
+
+static bool bench_state_equal(const schedule_current_state_t* const a, const schedule_current_state_t* const b)
+{
+    return a->on == b->on && a->allow_resume == b->allow_resume && a->in_region == b->in_region && a->timestamp_region_start == b->timestamp_region_start
+        && a->timestamp_region_next_on == b->timestamp_region_next_on && a->timestamp_region_next_off == b->timestamp_region_next_off;
+}
+
+/** Check a strategy against the reference over a pattern */
+static uint32_t bench_verify(const struct bench_schedule_t* const s, const enum bench_strategy_t strategy, const enum bench_pattern_t pattern)
+{
+    struct bench_ctx_t ctx;
+    bench_ctx_init(&ctx, s, strategy);
+    const bool rules = strategy == BENCH_RULES || strategy == BENCH_CURSOR_RULES;
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < SCHEDULE_BENCH_BOUNDARIES * 6; i++)
+    {
+        const int64_t t = bench_pattern_time(&ctx, pattern, i);
+        const schedule_current_state_t got = bench_lookup(&ctx, t);
+        /* Rules are compared against the expanded table only within the span of the table, as rules never end */
+        if (rules && (t <= (int64_t)s->table->epoch || t >= ctx.last - SCHEDULE_RULES_SECONDS_PER_DAY))
+            continue;
+        schedule_current_state_t ref = s->table->num_entries <= 4096 ? schedule_get_state_scan(s->table, t) : schedule_get_state(s->table, t);
+        if (rules)
+            ref.timestamp_region_next_on = got.timestamp_region_next_on, ref.timestamp_region_next_off = got.timestamp_region_next_off;
+        mismatches += !bench_state_equal(&got, &ref);
+    }
+    return mismatches;
+}
+
+static struct bench_result_t bench_run(const struct bench_schedule_t* const s, const enum bench_strategy_t strategy, const enum bench_pattern_t pattern)
+{
+    struct bench_result_t r = { 0 };
+    struct bench_ctx_t ctx;
+    bench_ctx_init(&ctx, s, strategy);
+    r.mismatches = bench_verify(s, strategy, pattern);
+
+    /* Touch everything once so the first batch isn't penalized for cold caches */
+    uint64_t sink = 0;
+    for (uint64_t i = 0; i < 64; i++)
+        sink += bench_lookup(&ctx, bench_pattern_time(&ctx, pattern, i)).timestamp_region_start;
+
+    /* Per-lookup clock reads are only worth their overhead when looking for the worst case */
+    const bool time_each = pattern == BENCH_BOUNDARY;
+    uint64_t clock_overhead = UINT64_MAX;
+    if (time_each)
+        for (int i = 0; i < 64; i++)
+        {
+            const uint64_t a = bench_now_ns();
+            const uint64_t b = bench_now_ns();
+            if (b - a < clock_overhead)
+                clock_overhead = b - a;
+        }
+
+    bench_counter_start(bench_counters.fd_l1d);
+    bench_counter_start(bench_counters.fd_llc);
+    const uint64_t start = bench_now_ns();
+    uint64_t elapsed = 0;
+    uint64_t measured = 0;
+    uint64_t batch = 1;
+    while (elapsed < SCHEDULE_BENCH_BUDGET_NS)
+    {
+        for (uint64_t i = 0; i < batch; i++, r.lookups++)
+        {
+            const int64_t t = bench_pattern_time(&ctx, pattern, r.lookups);
+            if (!time_each)
+            {
+                sink += bench_lookup(&ctx, t).timestamp_region_start;
+                continue;
+            }
+            const uint64_t a = bench_now_ns();
+            sink += bench_lookup(&ctx, t).timestamp_region_start;
+            const uint64_t d = bench_now_ns() - a;
+            const uint64_t ns = d > clock_overhead ? d - clock_overhead : 0;
+            measured += ns;
+            if (ns > r.max_ns)
+                r.max_ns = ns;
+        }
+        elapsed = bench_now_ns() - start;
+        if (batch < 65536)
+            batch *= 2;
+    }
+    const int64_t l1d = bench_counter_stop(bench_counters.fd_l1d);
+    const int64_t llc = bench_counter_stop(bench_counters.fd_llc);
+
+    r.ns_per_lookup = (double)(time_each ? measured : elapsed) / (double)r.lookups;
+    r.l1d_misses = l1d < 0 ? -1.0 : (double)l1d / (double)r.lookups;
+    r.llc_misses = llc < 0 ? -1.0 : (double)llc / (double)r.lookups;
+
+    /* Keep the lookups from being optimized away */
+    if (sink == 42)
+        printf("\n");
+    return r;
+}
+
+/* ================================ Report ================================ */
+
+static void bench_print_header(void)
+{
+    printf("%-16s %8s %10s  %-14s %-9s %10s %10s %9s %9s %9s %5s\n", "schedule", "entries", "bytes", "strategy", "pattern", "lookups", "ns/lookup",
+        "max ns", "L1D miss", "LLC miss", "err");
+}
+
+static void bench_print_misses(const double misses)
+{
+    if (misses < 0)
+        printf(" %9s", "n/a");
+    else
+        printf(" %9.3f", misses);
+}
+
+static size_t bench_strategy_bytes(const struct bench_schedule_t* const s, const enum bench_strategy_t strategy)
+{
+    switch (strategy)
+    {
+    case BENCH_SCAN:
+        return s->table->num_entries * sizeof(schedule_entry_t);
+    case BENCH_CURSOR_PACKED:
+        return s->packed->size;
+    case BENCH_RULES:
+    case BENCH_CURSOR_RULES:
+        return sizeof(*s->rules) + sizeof(schedule_entry_t) * (s->rules->regular.day_start[7] + s->rules->exception.day_start[7])
+            + sizeof(schedule_day_range_t) * s->rules->num_exceptions;
+    default:
+        return s->table_bytes;
+    }
+}
+
+/** @returns Number of mismatches */
+static uint32_t bench_schedule(const struct bench_schedule_t* const s)
+{
+    uint32_t mismatches = 0;
+    for (int strategy = 0; strategy < BENCH_STRATEGY_COUNT; strategy++)
+    {
+        if (!bench_strategy_available(s, strategy))
+            continue;
+        for (int pattern = 0; pattern < BENCH_PATTERN_COUNT; pattern++)
+        {
+            const struct bench_result_t r = bench_run(s, strategy, pattern);
+            printf("%-16s %8" PRIu32 " %10zu  %-14s %-9s %10" PRIu64 " %10.1f", s->name, s->table->num_entries, bench_strategy_bytes(s, strategy),
+                bench_strategy_names[strategy], bench_pattern_names[pattern], r.lookups, r.ns_per_lookup);
+            if (pattern == BENCH_BOUNDARY)
+                printf(" %9" PRIu64, r.max_ns);
+            else
+                printf(" %9s", "-");
+            bench_print_misses(r.l1d_misses);
+            bench_print_misses(r.llc_misses);
+            printf(" %5" PRIu32 "\n", r.mismatches);
+            mismatches += r.mismatches;
+        }
+    }
+    return mismatches;
+}
+
+static size_t bench_table_bytes(const schedule_t* const t) { return t->num_entries * sizeof(schedule_entry_t) + (t->num_entries + 1) * sizeof(uint32_t) * 3; }
+
+static uint32_t bench_all(const uint32_t max_entries)
+{
+    bench_counters_init();
+    bench_print_header();
+
+    uint32_t mismatches = 0;
+
+    const struct bench_schedule_t builtin[] = {
+        { "level_1", &schedule_level_1, &schedule_level_1_packed, &schedule_level_1_rules, bench_table_bytes(&schedule_level_1) },
+        { "level_2", &schedule_level_2, &schedule_level_2_packed, &schedule_level_2_rules, bench_table_bytes(&schedule_level_2) },
+    };
+    for (size_t i = 0; i < sizeof(builtin) / sizeof(*builtin); i++)
+        mismatches += bench_schedule(&builtin[i]);
+
+    for (uint32_t n = 1024; n <= max_entries; n *= 4)
+    {
+        struct bench_synthetic_t syn;
+        if (!bench_synthetic_init(&syn, n))
+        {
+            printf("Out of memory for %" PRIu32 " entries\n", n);
+            break;
+        }
+        char name[32];
+        snprintf(name, sizeof(name), "synthetic_%" PRIu32 "k", n / 1024);
+        const struct bench_schedule_t s = { name, &syn.table, &syn.packed, NULL, bench_table_bytes(&syn.table) };
+        mismatches += bench_schedule(&s);
+        bench_synthetic_free(&syn);
+    }
+
+    printf("%" PRIu32 " mismatches\n", mismatches);
+    return mismatches;
+}
+
+#if PICO_ON_DEVICE
+int main()
+{
+    stdio_init_all();
+    /* Give USB stdio a chance to connect */
+    sleep_ms(5000);
+    bench_all(SCHEDULE_BENCH_MAX_ENTRIES);
+    while (1)
+        tight_loop_contents();
+}
+#else
+int main(int argc, char** argv)
+{
+    uint32_t max_entries = SCHEDULE_BENCH_MAX_ENTRIES;
+    if (argc > 1)
+        max_entries = (uint32_t)strtoul(argv[1], NULL, 0);
+    if (argc > 2 || max_entries < 1)
+    {
+        fprintf(stderr, "Usage: %s [max synthetic entries (default: %u)]\n", argv[0], SCHEDULE_BENCH_MAX_ENTRIES);
+        return 2;
+    }
+    return bench_all(max_entries) ? 1 : 0;
+}
+#endif
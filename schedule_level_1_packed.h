@@ -0,0 +1,77 @@
+/* clang-format off */
+static const uint8_t schedule_level_1_packed_data[] = {
+    0x03, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e,
+    0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05,
+    0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xa7,
+    0x12, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x1d, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x1d, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xff, 0x1d, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xa7, 0x1d, 0x05, 0xa7, 0x09, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03,
+    0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03,
+    0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02,
+    0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03,
+    0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x26, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03,
+    0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02,
+    0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03,
+    0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03,
+    0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02,
+    0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xa7, 0x26, 0x05, 0xff, 0x3e, 0x05,
+    0xa7, 0x36, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03,
+    0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14,
+    0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03,
+    0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x1d, 0xb4, 0x03,
+    0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02,
+    0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03,
+    0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03,
+    0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02,
+    0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03,
+    0xcf, 0x1d, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03,
+    0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x1d, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02,
+    0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03,
+    0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03,
+    0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14,
+    0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03,
+    0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xf7, 0x25, 0x05, 0xa7, 0x36, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x1d, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf,
+    0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81,
+    0x03, 0xcf, 0x14, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4,
+    0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xcf, 0x02, 0xb4, 0x03, 0x81, 0x03, 0xa7,
+    0x1d, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e,
+    0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05,
+    0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05, 0xff, 0x3e, 0x05,
+};
+static const schedule_packed_t schedule_level_1_packed = { 1745939100ull, 300, 594, 1151, schedule_level_1_packed_data };
+/* clang-format on */
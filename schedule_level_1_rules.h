@@ -0,0 +1,42 @@
+/* clang-format off */
+static const schedule_entry_t schedule_level_1_rules_regular[] = {
+    {    28500, 1, 1 }, // Monday 07:55
+    {    61200, 0, 0 }, // Monday 17:00
+    {    90000, 0, 1 }, // Monday 25:00
+    {    28500, 1, 1 }, // Tuesday 07:55
+    {    61200, 0, 0 }, // Tuesday 17:00
+    {    90000, 0, 1 }, // Tuesday 25:00
+    {    28500, 1, 1 }, // Wednesday 07:55
+    {    61200, 0, 0 }, // Wednesday 17:00
+    {    90000, 0, 1 }, // Wednesday 25:00
+    {    28500, 1, 1 }, // Thursday 07:55
+    {    61200, 0, 0 }, // Thursday 17:00
+    {    90000, 0, 1 }, // Thursday 25:00
+    {    28500, 1, 1 }, // Friday 07:55
+    {    61200, 0, 0 }, // Friday 17:00
+    {    90000, 0, 1 }, // Friday 25:00
+};
+static const schedule_entry_t schedule_level_1_rules_exception[] = {
+    {    25500, 1, 1 }, // Tuesday 07:05
+    {    25800, 0, 1 }, // Tuesday 07:10
+};
+static const schedule_day_range_t schedule_level_1_rules_exceptions[] = {
+    { 20202, 20313 }, // 2025-04-24 - 2025-08-13
+    { 20332, 20332 }, // 2025-09-01 - 2025-09-01
+    { 20346, 20346 }, // 2025-09-15 - 2025-09-15
+    { 20395, 20395 }, // 2025-11-03 - 2025-11-03
+    { 20402, 20403 }, // 2025-11-10 - 2025-11-11
+    { 20419, 20420 }, // 2025-11-27 - 2025-11-28
+    { 20441, 20455 }, // 2025-12-19 - 2026-01-02
+    { 20472, 20472 }, // 2026-01-19 - 2026-01-19
+    { 20493, 20493 }, // 2026-02-09 - 2026-02-09
+    { 20500, 20500 }, // 2026-02-16 - 2026-02-16
+    { 20518, 20525 }, // 2026-03-06 - 2026-03-13
+    { 20574, 20574 }, // 2026-05-01 - 2026-05-01
+    { 20596, 20707 }, // 2026-05-23 - 2026-09-11
+};
+static const schedule_rules_t schedule_level_1_rules = {
+    { schedule_level_1_rules_regular, { 0, 0, 3, 6, 9, 12, 15, 15 } },
+    { schedule_level_1_rules_exception, { 0, 0, 0, 2, 2, 2, 2, 2 } },
+    13, schedule_level_1_rules_exceptions };
+/* clang-format on */
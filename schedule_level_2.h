@@ -1,599 +1,719 @@
 /* clang-format off */
-static const schedule_t schedule_level_2 = { 1745939100ull, 594,
-    {
-        {        0, 1, 1 }, // 2025-04-29 07:05:00 -08:00
-        {      300, 0, 1 }, // 2025-04-29 07:10:00 -08:00
-        {   604800, 1, 1 }, // 2025-05-06 07:05:00 -08:00
-        {   605100, 0, 1 }, // 2025-05-06 07:10:00 -08:00
-        {  1209600, 1, 1 }, // 2025-05-13 07:05:00 -08:00
-        {  1209900, 0, 1 }, // 2025-05-13 07:10:00 -08:00
-        {  1814400, 1, 1 }, // 2025-05-20 07:05:00 -08:00
-        {  1814700, 0, 1 }, // 2025-05-20 07:10:00 -08:00
-        {  2419200, 1, 1 }, // 2025-05-27 07:05:00 -08:00
-        {  2419500, 0, 1 }, // 2025-05-27 07:10:00 -08:00
-        {  3024000, 1, 1 }, // 2025-06-03 07:05:00 -08:00
-        {  3024300, 0, 1 }, // 2025-06-03 07:10:00 -08:00
-        {  3628800, 1, 1 }, // 2025-06-10 07:05:00 -08:00
-        {  3629100, 0, 1 }, // 2025-06-10 07:10:00 -08:00
-        {  4233600, 1, 1 }, // 2025-06-17 07:05:00 -08:00
-        {  4233900, 0, 1 }, // 2025-06-17 07:10:00 -08:00
-        {  4838400, 1, 1 }, // 2025-06-24 07:05:00 -08:00
-        {  4838700, 0, 1 }, // 2025-06-24 07:10:00 -08:00
-        {  5443200, 1, 1 }, // 2025-07-01 07:05:00 -08:00
-        {  5443500, 0, 1 }, // 2025-07-01 07:10:00 -08:00
-        {  6048000, 1, 1 }, // 2025-07-08 07:05:00 -08:00
-        {  6048300, 0, 1 }, // 2025-07-08 07:10:00 -08:00
-        {  6652800, 1, 1 }, // 2025-07-15 07:05:00 -08:00
-        {  6653100, 0, 1 }, // 2025-07-15 07:10:00 -08:00
-        {  7257600, 1, 1 }, // 2025-07-22 07:05:00 -08:00
-        {  7257900, 0, 1 }, // 2025-07-22 07:10:00 -08:00
-        {  7862400, 1, 1 }, // 2025-07-29 07:05:00 -08:00
-        {  7862700, 0, 1 }, // 2025-07-29 07:10:00 -08:00
-        {  8467200, 1, 1 }, // 2025-08-05 07:05:00 -08:00
-        {  8467500, 0, 1 }, // 2025-08-05 07:10:00 -08:00
-        {  9072000, 1, 1 }, // 2025-08-12 07:05:00 -08:00
-        {  9072300, 0, 1 }, // 2025-08-12 07:10:00 -08:00
-        {  9247800, 1, 1 }, // 2025-08-14 07:55:00 -08:00
-        {  9276900, 0, 0 }, // 2025-08-14 16:00:00 -08:00
-        {  9309300, 0, 1 }, // 2025-08-15 01:00:00 -08:00
-        {  9334200, 1, 1 }, // 2025-08-15 07:55:00 -08:00
-        {  9363300, 0, 0 }, // 2025-08-15 16:00:00 -08:00
-        {  9395700, 0, 1 }, // 2025-08-16 01:00:00 -08:00
-        {  9593400, 1, 1 }, // 2025-08-18 07:55:00 -08:00
-        {  9622500, 0, 0 }, // 2025-08-18 16:00:00 -08:00
-        {  9654900, 0, 1 }, // 2025-08-19 01:00:00 -08:00
-        {  9679800, 1, 1 }, // 2025-08-19 07:55:00 -08:00
-        {  9708900, 0, 0 }, // 2025-08-19 16:00:00 -08:00
-        {  9741300, 0, 1 }, // 2025-08-20 01:00:00 -08:00
-        {  9766200, 1, 1 }, // 2025-08-20 07:55:00 -08:00
-        {  9795300, 0, 0 }, // 2025-08-20 16:00:00 -08:00
-        {  9827700, 0, 1 }, // 2025-08-21 01:00:00 -08:00
-        {  9852600, 1, 1 }, // 2025-08-21 07:55:00 -08:00
-        {  9881700, 0, 0 }, // 2025-08-21 16:00:00 -08:00
-        {  9914100, 0, 1 }, // 2025-08-22 01:00:00 -08:00
-        {  9939000, 1, 1 }, // 2025-08-22 07:55:00 -08:00
-        {  9968100, 0, 0 }, // 2025-08-22 16:00:00 -08:00
-        { 10000500, 0, 1 }, // 2025-08-23 01:00:00 -08:00
-        { 10198200, 1, 1 }, // 2025-08-25 07:55:00 -08:00
-        { 10227300, 0, 0 }, // 2025-08-25 16:00:00 -08:00
-        { 10259700, 0, 1 }, // 2025-08-26 01:00:00 -08:00
-        { 10284600, 1, 1 }, // 2025-08-26 07:55:00 -08:00
-        { 10313700, 0, 0 }, // 2025-08-26 16:00:00 -08:00
-        { 10346100, 0, 1 }, // 2025-08-27 01:00:00 -08:00
-        { 10371000, 1, 1 }, // 2025-08-27 07:55:00 -08:00
-        { 10400100, 0, 0 }, // 2025-08-27 16:00:00 -08:00
-        { 10432500, 0, 1 }, // 2025-08-28 01:00:00 -08:00
-        { 10457400, 1, 1 }, // 2025-08-28 07:55:00 -08:00
-        { 10486500, 0, 0 }, // 2025-08-28 16:00:00 -08:00
-        { 10518900, 0, 1 }, // 2025-08-29 01:00:00 -08:00
-        { 10543800, 1, 1 }, // 2025-08-29 07:55:00 -08:00
-        { 10572900, 0, 0 }, // 2025-08-29 16:00:00 -08:00
-        { 10605300, 0, 1 }, // 2025-08-30 01:00:00 -08:00
-        { 10889400, 1, 1 }, // 2025-09-02 07:55:00 -08:00
-        { 10918500, 0, 0 }, // 2025-09-02 16:00:00 -08:00
-        { 10950900, 0, 1 }, // 2025-09-03 01:00:00 -08:00
-        { 10975800, 1, 1 }, // 2025-09-03 07:55:00 -08:00
-        { 11004900, 0, 0 }, // 2025-09-03 16:00:00 -08:00
-        { 11037300, 0, 1 }, // 2025-09-04 01:00:00 -08:00
-        { 11062200, 1, 1 }, // 2025-09-04 07:55:00 -08:00
-        { 11091300, 0, 0 }, // 2025-09-04 16:00:00 -08:00
-        { 11123700, 0, 1 }, // 2025-09-05 01:00:00 -08:00
-        { 11148600, 1, 1 }, // 2025-09-05 07:55:00 -08:00
-        { 11177700, 0, 0 }, // 2025-09-05 16:00:00 -08:00
-        { 11210100, 0, 1 }, // 2025-09-06 01:00:00 -08:00
-        { 11407800, 1, 1 }, // 2025-09-08 07:55:00 -08:00
-        { 11436900, 0, 0 }, // 2025-09-08 16:00:00 -08:00
-        { 11469300, 0, 1 }, // 2025-09-09 01:00:00 -08:00
-        { 11494200, 1, 1 }, // 2025-09-09 07:55:00 -08:00
-        { 11523300, 0, 0 }, // 2025-09-09 16:00:00 -08:00
-        { 11555700, 0, 1 }, // 2025-09-10 01:00:00 -08:00
-        { 11580600, 1, 1 }, // 2025-09-10 07:55:00 -08:00
-        { 11609700, 0, 0 }, // 2025-09-10 16:00:00 -08:00
-        { 11642100, 0, 1 }, // 2025-09-11 01:00:00 -08:00
-        { 11667000, 1, 1 }, // 2025-09-11 07:55:00 -08:00
-        { 11696100, 0, 0 }, // 2025-09-11 16:00:00 -08:00
-        { 11728500, 0, 1 }, // 2025-09-12 01:00:00 -08:00
-        { 11753400, 1, 1 }, // 2025-09-12 07:55:00 -08:00
-        { 11782500, 0, 0 }, // 2025-09-12 16:00:00 -08:00
-        { 11814900, 0, 1 }, // 2025-09-13 01:00:00 -08:00
-        { 12099000, 1, 1 }, // 2025-09-16 07:55:00 -08:00
-        { 12128100, 0, 0 }, // 2025-09-16 16:00:00 -08:00
-        { 12160500, 0, 1 }, // 2025-09-17 01:00:00 -08:00
-        { 12185400, 1, 1 }, // 2025-09-17 07:55:00 -08:00
-        { 12214500, 0, 0 }, // 2025-09-17 16:00:00 -08:00
-        { 12246900, 0, 1 }, // 2025-09-18 01:00:00 -08:00
-        { 12271800, 1, 1 }, // 2025-09-18 07:55:00 -08:00
-        { 12300900, 0, 0 }, // 2025-09-18 16:00:00 -08:00
-        { 12333300, 0, 1 }, // 2025-09-19 01:00:00 -08:00
-        { 12358200, 1, 1 }, // 2025-09-19 07:55:00 -08:00
-        { 12387300, 0, 0 }, // 2025-09-19 16:00:00 -08:00
-        { 12419700, 0, 1 }, // 2025-09-20 01:00:00 -08:00
-        { 12617400, 1, 1 }, // 2025-09-22 07:55:00 -08:00
-        { 12646500, 0, 0 }, // 2025-09-22 16:00:00 -08:00
-        { 12678900, 0, 1 }, // 2025-09-23 01:00:00 -08:00
-        { 12703800, 1, 1 }, // 2025-09-23 07:55:00 -08:00
-        { 12732900, 0, 0 }, // 2025-09-23 16:00:00 -08:00
-        { 12765300, 0, 1 }, // 2025-09-24 01:00:00 -08:00
-        { 12790200, 1, 1 }, // 2025-09-24 07:55:00 -08:00
-        { 12819300, 0, 0 }, // 2025-09-24 16:00:00 -08:00
-        { 12851700, 0, 1 }, // 2025-09-25 01:00:00 -08:00
-        { 12876600, 1, 1 }, // 2025-09-25 07:55:00 -08:00
-        { 12905700, 0, 0 }, // 2025-09-25 16:00:00 -08:00
-        { 12938100, 0, 1 }, // 2025-09-26 01:00:00 -08:00
-        { 12963000, 1, 1 }, // 2025-09-26 07:55:00 -08:00
-        { 12992100, 0, 0 }, // 2025-09-26 16:00:00 -08:00
-        { 13024500, 0, 1 }, // 2025-09-27 01:00:00 -08:00
-        { 13222200, 1, 1 }, // 2025-09-29 07:55:00 -08:00
-        { 13251300, 0, 0 }, // 2025-09-29 16:00:00 -08:00
-        { 13283700, 0, 1 }, // 2025-09-30 01:00:00 -08:00
-        { 13308600, 1, 1 }, // 2025-09-30 07:55:00 -08:00
-        { 13337700, 0, 0 }, // 2025-09-30 16:00:00 -08:00
-        { 13370100, 0, 1 }, // 2025-10-01 01:00:00 -08:00
-        { 13395000, 1, 1 }, // 2025-10-01 07:55:00 -08:00
-        { 13424100, 0, 0 }, // 2025-10-01 16:00:00 -08:00
-        { 13456500, 0, 1 }, // 2025-10-02 01:00:00 -08:00
-        { 13481400, 1, 1 }, // 2025-10-02 07:55:00 -08:00
-        { 13510500, 0, 0 }, // 2025-10-02 16:00:00 -08:00
-        { 13542900, 0, 1 }, // 2025-10-03 01:00:00 -08:00
-        { 13567800, 1, 1 }, // 2025-10-03 07:55:00 -08:00
-        { 13596900, 0, 0 }, // 2025-10-03 16:00:00 -08:00
-        { 13629300, 0, 1 }, // 2025-10-04 01:00:00 -08:00
-        { 13827000, 1, 1 }, // 2025-10-06 07:55:00 -08:00
-        { 13856100, 0, 0 }, // 2025-10-06 16:00:00 -08:00
-        { 13888500, 0, 1 }, // 2025-10-07 01:00:00 -08:00
-        { 13913400, 1, 1 }, // 2025-10-07 07:55:00 -08:00
-        { 13942500, 0, 0 }, // 2025-10-07 16:00:00 -08:00
-        { 13974900, 0, 1 }, // 2025-10-08 01:00:00 -08:00
-        { 13999800, 1, 1 }, // 2025-10-08 07:55:00 -08:00
-        { 14028900, 0, 0 }, // 2025-10-08 16:00:00 -08:00
-        { 14061300, 0, 1 }, // 2025-10-09 01:00:00 -08:00
-        { 14086200, 1, 1 }, // 2025-10-09 07:55:00 -08:00
-        { 14115300, 0, 0 }, // 2025-10-09 16:00:00 -08:00
-        { 14147700, 0, 1 }, // 2025-10-10 01:00:00 -08:00
-        { 14172600, 1, 1 }, // 2025-10-10 07:55:00 -08:00
-        { 14201700, 0, 0 }, // 2025-10-10 16:00:00 -08:00
-        { 14234100, 0, 1 }, // 2025-10-11 01:00:00 -08:00
-        { 14431800, 1, 1 }, // 2025-10-13 07:55:00 -08:00
-        { 14460900, 0, 0 }, // 2025-10-13 16:00:00 -08:00
-        { 14493300, 0, 1 }, // 2025-10-14 01:00:00 -08:00
-        { 14518200, 1, 1 }, // 2025-10-14 07:55:00 -08:00
-        { 14547300, 0, 0 }, // 2025-10-14 16:00:00 -08:00
-        { 14579700, 0, 1 }, // 2025-10-15 01:00:00 -08:00
-        { 14604600, 1, 1 }, // 2025-10-15 07:55:00 -08:00
-        { 14633700, 0, 0 }, // 2025-10-15 16:00:00 -08:00
-        { 14666100, 0, 1 }, // 2025-10-16 01:00:00 -08:00
-        { 14691000, 1, 1 }, // 2025-10-16 07:55:00 -08:00
-        { 14720100, 0, 0 }, // 2025-10-16 16:00:00 -08:00
-        { 14752500, 0, 1 }, // 2025-10-17 01:00:00 -08:00
-        { 14777400, 1, 1 }, // 2025-10-17 07:55:00 -08:00
-        { 14806500, 0, 0 }, // 2025-10-17 16:00:00 -08:00
-        { 14838900, 0, 1 }, // 2025-10-18 01:00:00 -08:00
-        { 15036600, 1, 1 }, // 2025-10-20 07:55:00 -08:00
-        { 15065700, 0, 0 }, // 2025-10-20 16:00:00 -08:00
-        { 15098100, 0, 1 }, // 2025-10-21 01:00:00 -08:00
-        { 15123000, 1, 1 }, // 2025-10-21 07:55:00 -08:00
-        { 15152100, 0, 0 }, // 2025-10-21 16:00:00 -08:00
-        { 15184500, 0, 1 }, // 2025-10-22 01:00:00 -08:00
-        { 15209400, 1, 1 }, // 2025-10-22 07:55:00 -08:00
-        { 15238500, 0, 0 }, // 2025-10-22 16:00:00 -08:00
-        { 15270900, 0, 1 }, // 2025-10-23 01:00:00 -08:00
-        { 15295800, 1, 1 }, // 2025-10-23 07:55:00 -08:00
-        { 15324900, 0, 0 }, // 2025-10-23 16:00:00 -08:00
-        { 15357300, 0, 1 }, // 2025-10-24 01:00:00 -08:00
-        { 15382200, 1, 1 }, // 2025-10-24 07:55:00 -08:00
-        { 15411300, 0, 0 }, // 2025-10-24 16:00:00 -08:00
-        { 15443700, 0, 1 }, // 2025-10-25 01:00:00 -08:00
-        { 15641400, 1, 1 }, // 2025-10-27 07:55:00 -08:00
-        { 15670500, 0, 0 }, // 2025-10-27 16:00:00 -08:00
-        { 15702900, 0, 1 }, // 2025-10-28 01:00:00 -08:00
-        { 15727800, 1, 1 }, // 2025-10-28 07:55:00 -08:00
-        { 15756900, 0, 0 }, // 2025-10-28 16:00:00 -08:00
-        { 15789300, 0, 1 }, // 2025-10-29 01:00:00 -08:00
-        { 15814200, 1, 1 }, // 2025-10-29 07:55:00 -08:00
-        { 15843300, 0, 0 }, // 2025-10-29 16:00:00 -08:00
-        { 15875700, 0, 1 }, // 2025-10-30 01:00:00 -08:00
-        { 15900600, 1, 1 }, // 2025-10-30 07:55:00 -08:00
-        { 15929700, 0, 0 }, // 2025-10-30 16:00:00 -08:00
-        { 15962100, 0, 1 }, // 2025-10-31 01:00:00 -08:00
-        { 15987000, 1, 1 }, // 2025-10-31 07:55:00 -08:00
-        { 16016100, 0, 0 }, // 2025-10-31 16:00:00 -08:00
-        { 16048500, 0, 1 }, // 2025-11-01 01:00:00 -08:00
-        { 16336200, 1, 1 }, // 2025-11-04 07:55:00 -09:00
-        { 16365300, 0, 0 }, // 2025-11-04 16:00:00 -09:00
-        { 16397700, 0, 1 }, // 2025-11-05 01:00:00 -09:00
-        { 16422600, 1, 1 }, // 2025-11-05 07:55:00 -09:00
-        { 16451700, 0, 0 }, // 2025-11-05 16:00:00 -09:00
-        { 16484100, 0, 1 }, // 2025-11-06 01:00:00 -09:00
-        { 16509000, 1, 1 }, // 2025-11-06 07:55:00 -09:00
-        { 16538100, 0, 0 }, // 2025-11-06 16:00:00 -09:00
-        { 16570500, 0, 1 }, // 2025-11-07 01:00:00 -09:00
-        { 16595400, 1, 1 }, // 2025-11-07 07:55:00 -09:00
-        { 16624500, 0, 0 }, // 2025-11-07 16:00:00 -09:00
-        { 16656900, 0, 1 }, // 2025-11-08 01:00:00 -09:00
-        { 16938000, 1, 1 }, // 2025-11-11 07:05:00 -09:00
-        { 16938300, 0, 1 }, // 2025-11-11 07:10:00 -09:00
-        { 17027400, 1, 1 }, // 2025-11-12 07:55:00 -09:00
-        { 17056500, 0, 0 }, // 2025-11-12 16:00:00 -09:00
-        { 17088900, 0, 1 }, // 2025-11-13 01:00:00 -09:00
-        { 17113800, 1, 1 }, // 2025-11-13 07:55:00 -09:00
-        { 17142900, 0, 0 }, // 2025-11-13 16:00:00 -09:00
-        { 17175300, 0, 1 }, // 2025-11-14 01:00:00 -09:00
-        { 17200200, 1, 1 }, // 2025-11-14 07:55:00 -09:00
-        { 17229300, 0, 0 }, // 2025-11-14 16:00:00 -09:00
-        { 17261700, 0, 1 }, // 2025-11-15 01:00:00 -09:00
-        { 17459400, 1, 1 }, // 2025-11-17 07:55:00 -09:00
-        { 17488500, 0, 0 }, // 2025-11-17 16:00:00 -09:00
-        { 17520900, 0, 1 }, // 2025-11-18 01:00:00 -09:00
-        { 17545800, 1, 1 }, // 2025-11-18 07:55:00 -09:00
-        { 17574900, 0, 0 }, // 2025-11-18 16:00:00 -09:00
-        { 17607300, 0, 1 }, // 2025-11-19 01:00:00 -09:00
-        { 17632200, 1, 1 }, // 2025-11-19 07:55:00 -09:00
-        { 17661300, 0, 0 }, // 2025-11-19 16:00:00 -09:00
-        { 17693700, 0, 1 }, // 2025-11-20 01:00:00 -09:00
-        { 17718600, 1, 1 }, // 2025-11-20 07:55:00 -09:00
-        { 17747700, 0, 0 }, // 2025-11-20 16:00:00 -09:00
-        { 17780100, 0, 1 }, // 2025-11-21 01:00:00 -09:00
-        { 17805000, 1, 1 }, // 2025-11-21 07:55:00 -09:00
-        { 17834100, 0, 0 }, // 2025-11-21 16:00:00 -09:00
-        { 17866500, 0, 1 }, // 2025-11-22 01:00:00 -09:00
-        { 18064200, 1, 1 }, // 2025-11-24 07:55:00 -09:00
-        { 18093300, 0, 0 }, // 2025-11-24 16:00:00 -09:00
-        { 18125700, 0, 1 }, // 2025-11-25 01:00:00 -09:00
-        { 18150600, 1, 1 }, // 2025-11-25 07:55:00 -09:00
-        { 18179700, 0, 0 }, // 2025-11-25 16:00:00 -09:00
-        { 18212100, 0, 1 }, // 2025-11-26 01:00:00 -09:00
-        { 18237000, 1, 1 }, // 2025-11-26 07:55:00 -09:00
-        { 18266100, 0, 0 }, // 2025-11-26 16:00:00 -09:00
-        { 18298500, 0, 1 }, // 2025-11-27 01:00:00 -09:00
-        { 18669000, 1, 1 }, // 2025-12-01 07:55:00 -09:00
-        { 18698100, 0, 0 }, // 2025-12-01 16:00:00 -09:00
-        { 18730500, 0, 1 }, // 2025-12-02 01:00:00 -09:00
-        { 18755400, 1, 1 }, // 2025-12-02 07:55:00 -09:00
-        { 18784500, 0, 0 }, // 2025-12-02 16:00:00 -09:00
-        { 18816900, 0, 1 }, // 2025-12-03 01:00:00 -09:00
-        { 18841800, 1, 1 }, // 2025-12-03 07:55:00 -09:00
-        { 18870900, 0, 0 }, // 2025-12-03 16:00:00 -09:00
-        { 18903300, 0, 1 }, // 2025-12-04 01:00:00 -09:00
-        { 18928200, 1, 1 }, // 2025-12-04 07:55:00 -09:00
-        { 18957300, 0, 0 }, // 2025-12-04 16:00:00 -09:00
-        { 18989700, 0, 1 }, // 2025-12-05 01:00:00 -09:00
-        { 19014600, 1, 1 }, // 2025-12-05 07:55:00 -09:00
-        { 19043700, 0, 0 }, // 2025-12-05 16:00:00 -09:00
-        { 19076100, 0, 1 }, // 2025-12-06 01:00:00 -09:00
-        { 19273800, 1, 1 }, // 2025-12-08 07:55:00 -09:00
-        { 19302900, 0, 0 }, // 2025-12-08 16:00:00 -09:00
-        { 19335300, 0, 1 }, // 2025-12-09 01:00:00 -09:00
-        { 19360200, 1, 1 }, // 2025-12-09 07:55:00 -09:00
-        { 19389300, 0, 0 }, // 2025-12-09 16:00:00 -09:00
-        { 19421700, 0, 1 }, // 2025-12-10 01:00:00 -09:00
-        { 19446600, 1, 1 }, // 2025-12-10 07:55:00 -09:00
-        { 19475700, 0, 0 }, // 2025-12-10 16:00:00 -09:00
-        { 19508100, 0, 1 }, // 2025-12-11 01:00:00 -09:00
-        { 19533000, 1, 1 }, // 2025-12-11 07:55:00 -09:00
-        { 19562100, 0, 0 }, // 2025-12-11 16:00:00 -09:00
-        { 19594500, 0, 1 }, // 2025-12-12 01:00:00 -09:00
-        { 19619400, 1, 1 }, // 2025-12-12 07:55:00 -09:00
-        { 19648500, 0, 0 }, // 2025-12-12 16:00:00 -09:00
-        { 19680900, 0, 1 }, // 2025-12-13 01:00:00 -09:00
-        { 19878600, 1, 1 }, // 2025-12-15 07:55:00 -09:00
-        { 19907700, 0, 0 }, // 2025-12-15 16:00:00 -09:00
-        { 19940100, 0, 1 }, // 2025-12-16 01:00:00 -09:00
-        { 19965000, 1, 1 }, // 2025-12-16 07:55:00 -09:00
-        { 19994100, 0, 0 }, // 2025-12-16 16:00:00 -09:00
-        { 20026500, 0, 1 }, // 2025-12-17 01:00:00 -09:00
-        { 20051400, 1, 1 }, // 2025-12-17 07:55:00 -09:00
-        { 20080500, 0, 0 }, // 2025-12-17 16:00:00 -09:00
-        { 20112900, 0, 1 }, // 2025-12-18 01:00:00 -09:00
-        { 20137800, 1, 1 }, // 2025-12-18 07:55:00 -09:00
-        { 20166900, 0, 0 }, // 2025-12-18 16:00:00 -09:00
-        { 20199300, 0, 1 }, // 2025-12-19 01:00:00 -09:00
-        { 20566800, 1, 1 }, // 2025-12-23 07:05:00 -09:00
-        { 20567100, 0, 1 }, // 2025-12-23 07:10:00 -09:00
-        { 21171600, 1, 1 }, // 2025-12-30 07:05:00 -09:00
-        { 21171900, 0, 1 }, // 2025-12-30 07:10:00 -09:00
-        { 21693000, 1, 1 }, // 2026-01-05 07:55:00 -09:00
-        { 21722100, 0, 0 }, // 2026-01-05 16:00:00 -09:00
-        { 21754500, 0, 1 }, // 2026-01-06 01:00:00 -09:00
-        { 21779400, 1, 1 }, // 2026-01-06 07:55:00 -09:00
-        { 21808500, 0, 0 }, // 2026-01-06 16:00:00 -09:00
-        { 21840900, 0, 1 }, // 2026-01-07 01:00:00 -09:00
-        { 21865800, 1, 1 }, // 2026-01-07 07:55:00 -09:00
-        { 21894900, 0, 0 }, // 2026-01-07 16:00:00 -09:00
-        { 21927300, 0, 1 }, // 2026-01-08 01:00:00 -09:00
-        { 21952200, 1, 1 }, // 2026-01-08 07:55:00 -09:00
-        { 21981300, 0, 0 }, // 2026-01-08 16:00:00 -09:00
-        { 22013700, 0, 1 }, // 2026-01-09 01:00:00 -09:00
-        { 22038600, 1, 1 }, // 2026-01-09 07:55:00 -09:00
-        { 22067700, 0, 0 }, // 2026-01-09 16:00:00 -09:00
-        { 22100100, 0, 1 }, // 2026-01-10 01:00:00 -09:00
-        { 22297800, 1, 1 }, // 2026-01-12 07:55:00 -09:00
-        { 22326900, 0, 0 }, // 2026-01-12 16:00:00 -09:00
-        { 22359300, 0, 1 }, // 2026-01-13 01:00:00 -09:00
-        { 22384200, 1, 1 }, // 2026-01-13 07:55:00 -09:00
-        { 22413300, 0, 0 }, // 2026-01-13 16:00:00 -09:00
-        { 22445700, 0, 1 }, // 2026-01-14 01:00:00 -09:00
-        { 22470600, 1, 1 }, // 2026-01-14 07:55:00 -09:00
-        { 22499700, 0, 0 }, // 2026-01-14 16:00:00 -09:00
-        { 22532100, 0, 1 }, // 2026-01-15 01:00:00 -09:00
-        { 22557000, 1, 1 }, // 2026-01-15 07:55:00 -09:00
-        { 22586100, 0, 0 }, // 2026-01-15 16:00:00 -09:00
-        { 22618500, 0, 1 }, // 2026-01-16 01:00:00 -09:00
-        { 22643400, 1, 1 }, // 2026-01-16 07:55:00 -09:00
-        { 22672500, 0, 0 }, // 2026-01-16 16:00:00 -09:00
-        { 22704900, 0, 1 }, // 2026-01-17 01:00:00 -09:00
-        { 22989000, 1, 1 }, // 2026-01-20 07:55:00 -09:00
-        { 23018100, 0, 0 }, // 2026-01-20 16:00:00 -09:00
-        { 23050500, 0, 1 }, // 2026-01-21 01:00:00 -09:00
-        { 23075400, 1, 1 }, // 2026-01-21 07:55:00 -09:00
-        { 23104500, 0, 0 }, // 2026-01-21 16:00:00 -09:00
-        { 23136900, 0, 1 }, // 2026-01-22 01:00:00 -09:00
-        { 23161800, 1, 1 }, // 2026-01-22 07:55:00 -09:00
-        { 23190900, 0, 0 }, // 2026-01-22 16:00:00 -09:00
-        { 23223300, 0, 1 }, // 2026-01-23 01:00:00 -09:00
-        { 23248200, 1, 1 }, // 2026-01-23 07:55:00 -09:00
-        { 23277300, 0, 0 }, // 2026-01-23 16:00:00 -09:00
-        { 23309700, 0, 1 }, // 2026-01-24 01:00:00 -09:00
-        { 23507400, 1, 1 }, // 2026-01-26 07:55:00 -09:00
-        { 23536500, 0, 0 }, // 2026-01-26 16:00:00 -09:00
-        { 23568900, 0, 1 }, // 2026-01-27 01:00:00 -09:00
-        { 23593800, 1, 1 }, // 2026-01-27 07:55:00 -09:00
-        { 23622900, 0, 0 }, // 2026-01-27 16:00:00 -09:00
-        { 23655300, 0, 1 }, // 2026-01-28 01:00:00 -09:00
-        { 23680200, 1, 1 }, // 2026-01-28 07:55:00 -09:00
-        { 23709300, 0, 0 }, // 2026-01-28 16:00:00 -09:00
-        { 23741700, 0, 1 }, // 2026-01-29 01:00:00 -09:00
-        { 23766600, 1, 1 }, // 2026-01-29 07:55:00 -09:00
-        { 23795700, 0, 0 }, // 2026-01-29 16:00:00 -09:00
-        { 23828100, 0, 1 }, // 2026-01-30 01:00:00 -09:00
-        { 23853000, 1, 1 }, // 2026-01-30 07:55:00 -09:00
-        { 23882100, 0, 0 }, // 2026-01-30 16:00:00 -09:00
-        { 23914500, 0, 1 }, // 2026-01-31 01:00:00 -09:00
-        { 24112200, 1, 1 }, // 2026-02-02 07:55:00 -09:00
-        { 24141300, 0, 0 }, // 2026-02-02 16:00:00 -09:00
-        { 24173700, 0, 1 }, // 2026-02-03 01:00:00 -09:00
-        { 24198600, 1, 1 }, // 2026-02-03 07:55:00 -09:00
-        { 24227700, 0, 0 }, // 2026-02-03 16:00:00 -09:00
-        { 24260100, 0, 1 }, // 2026-02-04 01:00:00 -09:00
-        { 24285000, 1, 1 }, // 2026-02-04 07:55:00 -09:00
-        { 24314100, 0, 0 }, // 2026-02-04 16:00:00 -09:00
-        { 24346500, 0, 1 }, // 2026-02-05 01:00:00 -09:00
-        { 24371400, 1, 1 }, // 2026-02-05 07:55:00 -09:00
-        { 24400500, 0, 0 }, // 2026-02-05 16:00:00 -09:00
-        { 24432900, 0, 1 }, // 2026-02-06 01:00:00 -09:00
-        { 24457800, 1, 1 }, // 2026-02-06 07:55:00 -09:00
-        { 24486900, 0, 0 }, // 2026-02-06 16:00:00 -09:00
-        { 24519300, 0, 1 }, // 2026-02-07 01:00:00 -09:00
-        { 24803400, 1, 1 }, // 2026-02-10 07:55:00 -09:00
-        { 24832500, 0, 0 }, // 2026-02-10 16:00:00 -09:00
-        { 24864900, 0, 1 }, // 2026-02-11 01:00:00 -09:00
-        { 24889800, 1, 1 }, // 2026-02-11 07:55:00 -09:00
-        { 24918900, 0, 0 }, // 2026-02-11 16:00:00 -09:00
-        { 24951300, 0, 1 }, // 2026-02-12 01:00:00 -09:00
-        { 24976200, 1, 1 }, // 2026-02-12 07:55:00 -09:00
-        { 25005300, 0, 0 }, // 2026-02-12 16:00:00 -09:00
-        { 25037700, 0, 1 }, // 2026-02-13 01:00:00 -09:00
-        { 25062600, 1, 1 }, // 2026-02-13 07:55:00 -09:00
-        { 25091700, 0, 0 }, // 2026-02-13 16:00:00 -09:00
-        { 25124100, 0, 1 }, // 2026-02-14 01:00:00 -09:00
-        { 25408200, 1, 1 }, // 2026-02-17 07:55:00 -09:00
-        { 25437300, 0, 0 }, // 2026-02-17 16:00:00 -09:00
-        { 25469700, 0, 1 }, // 2026-02-18 01:00:00 -09:00
-        { 25494600, 1, 1 }, // 2026-02-18 07:55:00 -09:00
-        { 25523700, 0, 0 }, // 2026-02-18 16:00:00 -09:00
-        { 25556100, 0, 1 }, // 2026-02-19 01:00:00 -09:00
-        { 25581000, 1, 1 }, // 2026-02-19 07:55:00 -09:00
-        { 25610100, 0, 0 }, // 2026-02-19 16:00:00 -09:00
-        { 25642500, 0, 1 }, // 2026-02-20 01:00:00 -09:00
-        { 25667400, 1, 1 }, // 2026-02-20 07:55:00 -09:00
-        { 25696500, 0, 0 }, // 2026-02-20 16:00:00 -09:00
-        { 25728900, 0, 1 }, // 2026-02-21 01:00:00 -09:00
-        { 25926600, 1, 1 }, // 2026-02-23 07:55:00 -09:00
-        { 25955700, 0, 0 }, // 2026-02-23 16:00:00 -09:00
-        { 25988100, 0, 1 }, // 2026-02-24 01:00:00 -09:00
-        { 26013000, 1, 1 }, // 2026-02-24 07:55:00 -09:00
-        { 26042100, 0, 0 }, // 2026-02-24 16:00:00 -09:00
-        { 26074500, 0, 1 }, // 2026-02-25 01:00:00 -09:00
-        { 26099400, 1, 1 }, // 2026-02-25 07:55:00 -09:00
-        { 26128500, 0, 0 }, // 2026-02-25 16:00:00 -09:00
-        { 26160900, 0, 1 }, // 2026-02-26 01:00:00 -09:00
-        { 26185800, 1, 1 }, // 2026-02-26 07:55:00 -09:00
-        { 26214900, 0, 0 }, // 2026-02-26 16:00:00 -09:00
-        { 26247300, 0, 1 }, // 2026-02-27 01:00:00 -09:00
-        { 26272200, 1, 1 }, // 2026-02-27 07:55:00 -09:00
-        { 26301300, 0, 0 }, // 2026-02-27 16:00:00 -09:00
-        { 26333700, 0, 1 }, // 2026-02-28 01:00:00 -09:00
-        { 26531400, 1, 1 }, // 2026-03-02 07:55:00 -09:00
-        { 26560500, 0, 0 }, // 2026-03-02 16:00:00 -09:00
-        { 26592900, 0, 1 }, // 2026-03-03 01:00:00 -09:00
-        { 26617800, 1, 1 }, // 2026-03-03 07:55:00 -09:00
-        { 26646900, 0, 0 }, // 2026-03-03 16:00:00 -09:00
-        { 26679300, 0, 1 }, // 2026-03-04 01:00:00 -09:00
-        { 26704200, 1, 1 }, // 2026-03-04 07:55:00 -09:00
-        { 26733300, 0, 0 }, // 2026-03-04 16:00:00 -09:00
-        { 26765700, 0, 1 }, // 2026-03-05 01:00:00 -09:00
-        { 26790600, 1, 1 }, // 2026-03-05 07:55:00 -09:00
-        { 26819700, 0, 0 }, // 2026-03-05 16:00:00 -09:00
-        { 26852100, 0, 1 }, // 2026-03-06 01:00:00 -09:00
-        { 27216000, 1, 1 }, // 2026-03-10 07:05:00 -08:00
-        { 27216300, 0, 1 }, // 2026-03-10 07:10:00 -08:00
-        { 27737400, 1, 1 }, // 2026-03-16 07:55:00 -08:00
-        { 27766500, 0, 0 }, // 2026-03-16 16:00:00 -08:00
-        { 27798900, 0, 1 }, // 2026-03-17 01:00:00 -08:00
-        { 27823800, 1, 1 }, // 2026-03-17 07:55:00 -08:00
-        { 27852900, 0, 0 }, // 2026-03-17 16:00:00 -08:00
-        { 27885300, 0, 1 }, // 2026-03-18 01:00:00 -08:00
-        { 27910200, 1, 1 }, // 2026-03-18 07:55:00 -08:00
-        { 27939300, 0, 0 }, // 2026-03-18 16:00:00 -08:00
-        { 27971700, 0, 1 }, // 2026-03-19 01:00:00 -08:00
-        { 27996600, 1, 1 }, // 2026-03-19 07:55:00 -08:00
-        { 28025700, 0, 0 }, // 2026-03-19 16:00:00 -08:00
-        { 28058100, 0, 1 }, // 2026-03-20 01:00:00 -08:00
-        { 28083000, 1, 1 }, // 2026-03-20 07:55:00 -08:00
-        { 28112100, 0, 0 }, // 2026-03-20 16:00:00 -08:00
-        { 28144500, 0, 1 }, // 2026-03-21 01:00:00 -08:00
-        { 28342200, 1, 1 }, // 2026-03-23 07:55:00 -08:00
-        { 28371300, 0, 0 }, // 2026-03-23 16:00:00 -08:00
-        { 28403700, 0, 1 }, // 2026-03-24 01:00:00 -08:00
-        { 28428600, 1, 1 }, // 2026-03-24 07:55:00 -08:00
-        { 28457700, 0, 0 }, // 2026-03-24 16:00:00 -08:00
-        { 28490100, 0, 1 }, // 2026-03-25 01:00:00 -08:00
-        { 28515000, 1, 1 }, // 2026-03-25 07:55:00 -08:00
-        { 28544100, 0, 0 }, // 2026-03-25 16:00:00 -08:00
-        { 28576500, 0, 1 }, // 2026-03-26 01:00:00 -08:00
-        { 28601400, 1, 1 }, // 2026-03-26 07:55:00 -08:00
-        { 28630500, 0, 0 }, // 2026-03-26 16:00:00 -08:00
-        { 28662900, 0, 1 }, // 2026-03-27 01:00:00 -08:00
-        { 28687800, 1, 1 }, // 2026-03-27 07:55:00 -08:00
-        { 28716900, 0, 0 }, // 2026-03-27 16:00:00 -08:00
-        { 28749300, 0, 1 }, // 2026-03-28 01:00:00 -08:00
-        { 28947000, 1, 1 }, // 2026-03-30 07:55:00 -08:00
-        { 28976100, 0, 0 }, // 2026-03-30 16:00:00 -08:00
-        { 29008500, 0, 1 }, // 2026-03-31 01:00:00 -08:00
-        { 29033400, 1, 1 }, // 2026-03-31 07:55:00 -08:00
-        { 29062500, 0, 0 }, // 2026-03-31 16:00:00 -08:00
-        { 29094900, 0, 1 }, // 2026-04-01 01:00:00 -08:00
-        { 29119800, 1, 1 }, // 2026-04-01 07:55:00 -08:00
-        { 29148900, 0, 0 }, // 2026-04-01 16:00:00 -08:00
-        { 29181300, 0, 1 }, // 2026-04-02 01:00:00 -08:00
-        { 29206200, 1, 1 }, // 2026-04-02 07:55:00 -08:00
-        { 29235300, 0, 0 }, // 2026-04-02 16:00:00 -08:00
-        { 29267700, 0, 1 }, // 2026-04-03 01:00:00 -08:00
-        { 29292600, 1, 1 }, // 2026-04-03 07:55:00 -08:00
-        { 29321700, 0, 0 }, // 2026-04-03 16:00:00 -08:00
-        { 29354100, 0, 1 }, // 2026-04-04 01:00:00 -08:00
-        { 29551800, 1, 1 }, // 2026-04-06 07:55:00 -08:00
-        { 29580900, 0, 0 }, // 2026-04-06 16:00:00 -08:00
-        { 29613300, 0, 1 }, // 2026-04-07 01:00:00 -08:00
-        { 29638200, 1, 1 }, // 2026-04-07 07:55:00 -08:00
-        { 29667300, 0, 0 }, // 2026-04-07 16:00:00 -08:00
-        { 29699700, 0, 1 }, // 2026-04-08 01:00:00 -08:00
-        { 29724600, 1, 1 }, // 2026-04-08 07:55:00 -08:00
-        { 29753700, 0, 0 }, // 2026-04-08 16:00:00 -08:00
-        { 29786100, 0, 1 }, // 2026-04-09 01:00:00 -08:00
-        { 29811000, 1, 1 }, // 2026-04-09 07:55:00 -08:00
-        { 29840100, 0, 0 }, // 2026-04-09 16:00:00 -08:00
-        { 29872500, 0, 1 }, // 2026-04-10 01:00:00 -08:00
-        { 29897400, 1, 1 }, // 2026-04-10 07:55:00 -08:00
-        { 29926500, 0, 0 }, // 2026-04-10 16:00:00 -08:00
-        { 29958900, 0, 1 }, // 2026-04-11 01:00:00 -08:00
-        { 30156600, 1, 1 }, // 2026-04-13 07:55:00 -08:00
-        { 30185700, 0, 0 }, // 2026-04-13 16:00:00 -08:00
-        { 30218100, 0, 1 }, // 2026-04-14 01:00:00 -08:00
-        { 30243000, 1, 1 }, // 2026-04-14 07:55:00 -08:00
-        { 30272100, 0, 0 }, // 2026-04-14 16:00:00 -08:00
-        { 30304500, 0, 1 }, // 2026-04-15 01:00:00 -08:00
-        { 30329400, 1, 1 }, // 2026-04-15 07:55:00 -08:00
-        { 30358500, 0, 0 }, // 2026-04-15 16:00:00 -08:00
-        { 30390900, 0, 1 }, // 2026-04-16 01:00:00 -08:00
-        { 30415800, 1, 1 }, // 2026-04-16 07:55:00 -08:00
-        { 30444900, 0, 0 }, // 2026-04-16 16:00:00 -08:00
-        { 30477300, 0, 1 }, // 2026-04-17 01:00:00 -08:00
-        { 30502200, 1, 1 }, // 2026-04-17 07:55:00 -08:00
-        { 30531300, 0, 0 }, // 2026-04-17 16:00:00 -08:00
-        { 30563700, 0, 1 }, // 2026-04-18 01:00:00 -08:00
-        { 30761400, 1, 1 }, // 2026-04-20 07:55:00 -08:00
-        { 30790500, 0, 0 }, // 2026-04-20 16:00:00 -08:00
-        { 30822900, 0, 1 }, // 2026-04-21 01:00:00 -08:00
-        { 30847800, 1, 1 }, // 2026-04-21 07:55:00 -08:00
-        { 30876900, 0, 0 }, // 2026-04-21 16:00:00 -08:00
-        { 30909300, 0, 1 }, // 2026-04-22 01:00:00 -08:00
-        { 30934200, 1, 1 }, // 2026-04-22 07:55:00 -08:00
-        { 30963300, 0, 0 }, // 2026-04-22 16:00:00 -08:00
-        { 30995700, 0, 1 }, // 2026-04-23 01:00:00 -08:00
-        { 31020600, 1, 1 }, // 2026-04-23 07:55:00 -08:00
-        { 31049700, 0, 0 }, // 2026-04-23 16:00:00 -08:00
-        { 31082100, 0, 1 }, // 2026-04-24 01:00:00 -08:00
-        { 31107000, 1, 1 }, // 2026-04-24 07:55:00 -08:00
-        { 31136100, 0, 0 }, // 2026-04-24 16:00:00 -08:00
-        { 31168500, 0, 1 }, // 2026-04-25 01:00:00 -08:00
-        { 31366200, 1, 1 }, // 2026-04-27 07:55:00 -08:00
-        { 31395300, 0, 0 }, // 2026-04-27 16:00:00 -08:00
-        { 31427700, 0, 1 }, // 2026-04-28 01:00:00 -08:00
-        { 31452600, 1, 1 }, // 2026-04-28 07:55:00 -08:00
-        { 31481700, 0, 0 }, // 2026-04-28 16:00:00 -08:00
-        { 31514100, 0, 1 }, // 2026-04-29 01:00:00 -08:00
-        { 31539000, 1, 1 }, // 2026-04-29 07:55:00 -08:00
-        { 31568100, 0, 0 }, // 2026-04-29 16:00:00 -08:00
-        { 31600500, 0, 1 }, // 2026-04-30 01:00:00 -08:00
-        { 31625400, 1, 1 }, // 2026-04-30 07:55:00 -08:00
-        { 31654500, 0, 0 }, // 2026-04-30 16:00:00 -08:00
-        { 31686900, 0, 1 }, // 2026-05-01 01:00:00 -08:00
-        { 31971000, 1, 1 }, // 2026-05-04 07:55:00 -08:00
-        { 32000100, 0, 0 }, // 2026-05-04 16:00:00 -08:00
-        { 32032500, 0, 1 }, // 2026-05-05 01:00:00 -08:00
-        { 32057400, 1, 1 }, // 2026-05-05 07:55:00 -08:00
-        { 32086500, 0, 0 }, // 2026-05-05 16:00:00 -08:00
-        { 32118900, 0, 1 }, // 2026-05-06 01:00:00 -08:00
-        { 32143800, 1, 1 }, // 2026-05-06 07:55:00 -08:00
-        { 32172900, 0, 0 }, // 2026-05-06 16:00:00 -08:00
-        { 32205300, 0, 1 }, // 2026-05-07 01:00:00 -08:00
-        { 32230200, 1, 1 }, // 2026-05-07 07:55:00 -08:00
-        { 32259300, 0, 0 }, // 2026-05-07 16:00:00 -08:00
-        { 32291700, 0, 1 }, // 2026-05-08 01:00:00 -08:00
-        { 32316600, 1, 1 }, // 2026-05-08 07:55:00 -08:00
-        { 32345700, 0, 0 }, // 2026-05-08 16:00:00 -08:00
-        { 32378100, 0, 1 }, // 2026-05-09 01:00:00 -08:00
-        { 32575800, 1, 1 }, // 2026-05-11 07:55:00 -08:00
-        { 32604900, 0, 0 }, // 2026-05-11 16:00:00 -08:00
-        { 32637300, 0, 1 }, // 2026-05-12 01:00:00 -08:00
-        { 32662200, 1, 1 }, // 2026-05-12 07:55:00 -08:00
-        { 32691300, 0, 0 }, // 2026-05-12 16:00:00 -08:00
-        { 32723700, 0, 1 }, // 2026-05-13 01:00:00 -08:00
-        { 32748600, 1, 1 }, // 2026-05-13 07:55:00 -08:00
-        { 32777700, 0, 0 }, // 2026-05-13 16:00:00 -08:00
-        { 32810100, 0, 1 }, // 2026-05-14 01:00:00 -08:00
-        { 32835000, 1, 1 }, // 2026-05-14 07:55:00 -08:00
-        { 32864100, 0, 0 }, // 2026-05-14 16:00:00 -08:00
-        { 32896500, 0, 1 }, // 2026-05-15 01:00:00 -08:00
-        { 32921400, 1, 1 }, // 2026-05-15 07:55:00 -08:00
-        { 32950500, 0, 0 }, // 2026-05-15 16:00:00 -08:00
-        { 32982900, 0, 1 }, // 2026-05-16 01:00:00 -08:00
-        { 33180600, 1, 1 }, // 2026-05-18 07:55:00 -08:00
-        { 33209700, 0, 0 }, // 2026-05-18 16:00:00 -08:00
-        { 33242100, 0, 1 }, // 2026-05-19 01:00:00 -08:00
-        { 33267000, 1, 1 }, // 2026-05-19 07:55:00 -08:00
-        { 33296100, 0, 0 }, // 2026-05-19 16:00:00 -08:00
-        { 33328500, 0, 1 }, // 2026-05-20 01:00:00 -08:00
-        { 33353400, 1, 1 }, // 2026-05-20 07:55:00 -08:00
-        { 33382500, 0, 0 }, // 2026-05-20 16:00:00 -08:00
-        { 33414900, 0, 1 }, // 2026-05-21 01:00:00 -08:00
-        { 33439800, 1, 1 }, // 2026-05-21 07:55:00 -08:00
-        { 33468900, 0, 0 }, // 2026-05-21 16:00:00 -08:00
-        { 33501300, 0, 1 }, // 2026-05-22 01:00:00 -08:00
-        { 33526200, 1, 1 }, // 2026-05-22 07:55:00 -08:00
-        { 33555300, 0, 0 }, // 2026-05-22 16:00:00 -08:00
-        { 33587700, 0, 1 }, // 2026-05-23 01:00:00 -08:00
-        { 33868800, 1, 1 }, // 2026-05-26 07:05:00 -08:00
-        { 33869100, 0, 1 }, // 2026-05-26 07:10:00 -08:00
-        { 34473600, 1, 1 }, // 2026-06-02 07:05:00 -08:00
-        { 34473900, 0, 1 }, // 2026-06-02 07:10:00 -08:00
-        { 35078400, 1, 1 }, // 2026-06-09 07:05:00 -08:00
-        { 35078700, 0, 1 }, // 2026-06-09 07:10:00 -08:00
-        { 35683200, 1, 1 }, // 2026-06-16 07:05:00 -08:00
-        { 35683500, 0, 1 }, // 2026-06-16 07:10:00 -08:00
-        { 36288000, 1, 1 }, // 2026-06-23 07:05:00 -08:00
-        { 36288300, 0, 1 }, // 2026-06-23 07:10:00 -08:00
-        { 36892800, 1, 1 }, // 2026-06-30 07:05:00 -08:00
-        { 36893100, 0, 1 }, // 2026-06-30 07:10:00 -08:00
-        { 37497600, 1, 1 }, // 2026-07-07 07:05:00 -08:00
-        { 37497900, 0, 1 }, // 2026-07-07 07:10:00 -08:00
-        { 38102400, 1, 1 }, // 2026-07-14 07:05:00 -08:00
-        { 38102700, 0, 1 }, // 2026-07-14 07:10:00 -08:00
-        { 38707200, 1, 1 }, // 2026-07-21 07:05:00 -08:00
-        { 38707500, 0, 1 }, // 2026-07-21 07:10:00 -08:00
-        { 39312000, 1, 1 }, // 2026-07-28 07:05:00 -08:00
-        { 39312300, 0, 1 }, // 2026-07-28 07:10:00 -08:00
-        { 39916800, 1, 1 }, // 2026-08-04 07:05:00 -08:00
-        { 39917100, 0, 1 }, // 2026-08-04 07:10:00 -08:00
-        { 40521600, 1, 1 }, // 2026-08-11 07:05:00 -08:00
-        { 40521900, 0, 1 }, // 2026-08-11 07:10:00 -08:00
-        { 41126400, 1, 1 }, // 2026-08-18 07:05:00 -08:00
-        { 41126700, 0, 1 }, // 2026-08-18 07:10:00 -08:00
-        { 41731200, 1, 1 }, // 2026-08-25 07:05:00 -08:00
-        { 41731500, 0, 1 }, // 2026-08-25 07:10:00 -08:00
-        { 42336000, 1, 1 }, // 2026-09-01 07:05:00 -08:00
-        { 42336300, 0, 1 }, // 2026-09-01 07:10:00 -08:00
-        { 42940800, 1, 1 }, // 2026-09-08 07:05:00 -08:00
-        { 42941100, 0, 1 }, // 2026-09-08 07:10:00 -08:00
-    } };
+static const schedule_entry_t schedule_level_2_entries[] = {
+    {        0, 1, 1 }, // 2025-04-29 07:05:00 -08:00
+    {      300, 0, 1 }, // 2025-04-29 07:10:00 -08:00
+    {   604800, 1, 1 }, // 2025-05-06 07:05:00 -08:00
+    {   605100, 0, 1 }, // 2025-05-06 07:10:00 -08:00
+    {  1209600, 1, 1 }, // 2025-05-13 07:05:00 -08:00
+    {  1209900, 0, 1 }, // 2025-05-13 07:10:00 -08:00
+    {  1814400, 1, 1 }, // 2025-05-20 07:05:00 -08:00
+    {  1814700, 0, 1 }, // 2025-05-20 07:10:00 -08:00
+    {  2419200, 1, 1 }, // 2025-05-27 07:05:00 -08:00
+    {  2419500, 0, 1 }, // 2025-05-27 07:10:00 -08:00
+    {  3024000, 1, 1 }, // 2025-06-03 07:05:00 -08:00
+    {  3024300, 0, 1 }, // 2025-06-03 07:10:00 -08:00
+    {  3628800, 1, 1 }, // 2025-06-10 07:05:00 -08:00
+    {  3629100, 0, 1 }, // 2025-06-10 07:10:00 -08:00
+    {  4233600, 1, 1 }, // 2025-06-17 07:05:00 -08:00
+    {  4233900, 0, 1 }, // 2025-06-17 07:10:00 -08:00
+    {  4838400, 1, 1 }, // 2025-06-24 07:05:00 -08:00
+    {  4838700, 0, 1 }, // 2025-06-24 07:10:00 -08:00
+    {  5443200, 1, 1 }, // 2025-07-01 07:05:00 -08:00
+    {  5443500, 0, 1 }, // 2025-07-01 07:10:00 -08:00
+    {  6048000, 1, 1 }, // 2025-07-08 07:05:00 -08:00
+    {  6048300, 0, 1 }, // 2025-07-08 07:10:00 -08:00
+    {  6652800, 1, 1 }, // 2025-07-15 07:05:00 -08:00
+    {  6653100, 0, 1 }, // 2025-07-15 07:10:00 -08:00
+    {  7257600, 1, 1 }, // 2025-07-22 07:05:00 -08:00
+    {  7257900, 0, 1 }, // 2025-07-22 07:10:00 -08:00
+    {  7862400, 1, 1 }, // 2025-07-29 07:05:00 -08:00
+    {  7862700, 0, 1 }, // 2025-07-29 07:10:00 -08:00
+    {  8467200, 1, 1 }, // 2025-08-05 07:05:00 -08:00
+    {  8467500, 0, 1 }, // 2025-08-05 07:10:00 -08:00
+    {  9072000, 1, 1 }, // 2025-08-12 07:05:00 -08:00
+    {  9072300, 0, 1 }, // 2025-08-12 07:10:00 -08:00
+    {  9247800, 1, 1 }, // 2025-08-14 07:55:00 -08:00
+    {  9276900, 0, 0 }, // 2025-08-14 16:00:00 -08:00
+    {  9309300, 0, 1 }, // 2025-08-15 01:00:00 -08:00
+    {  9334200, 1, 1 }, // 2025-08-15 07:55:00 -08:00
+    {  9363300, 0, 0 }, // 2025-08-15 16:00:00 -08:00
+    {  9395700, 0, 1 }, // 2025-08-16 01:00:00 -08:00
+    {  9593400, 1, 1 }, // 2025-08-18 07:55:00 -08:00
+    {  9622500, 0, 0 }, // 2025-08-18 16:00:00 -08:00
+    {  9654900, 0, 1 }, // 2025-08-19 01:00:00 -08:00
+    {  9679800, 1, 1 }, // 2025-08-19 07:55:00 -08:00
+    {  9708900, 0, 0 }, // 2025-08-19 16:00:00 -08:00
+    {  9741300, 0, 1 }, // 2025-08-20 01:00:00 -08:00
+    {  9766200, 1, 1 }, // 2025-08-20 07:55:00 -08:00
+    {  9795300, 0, 0 }, // 2025-08-20 16:00:00 -08:00
+    {  9827700, 0, 1 }, // 2025-08-21 01:00:00 -08:00
+    {  9852600, 1, 1 }, // 2025-08-21 07:55:00 -08:00
+    {  9881700, 0, 0 }, // 2025-08-21 16:00:00 -08:00
+    {  9914100, 0, 1 }, // 2025-08-22 01:00:00 -08:00
+    {  9939000, 1, 1 }, // 2025-08-22 07:55:00 -08:00
+    {  9968100, 0, 0 }, // 2025-08-22 16:00:00 -08:00
+    { 10000500, 0, 1 }, // 2025-08-23 01:00:00 -08:00
+    { 10198200, 1, 1 }, // 2025-08-25 07:55:00 -08:00
+    { 10227300, 0, 0 }, // 2025-08-25 16:00:00 -08:00
+    { 10259700, 0, 1 }, // 2025-08-26 01:00:00 -08:00
+    { 10284600, 1, 1 }, // 2025-08-26 07:55:00 -08:00
+    { 10313700, 0, 0 }, // 2025-08-26 16:00:00 -08:00
+    { 10346100, 0, 1 }, // 2025-08-27 01:00:00 -08:00
+    { 10371000, 1, 1 }, // 2025-08-27 07:55:00 -08:00
+    { 10400100, 0, 0 }, // 2025-08-27 16:00:00 -08:00
+    { 10432500, 0, 1 }, // 2025-08-28 01:00:00 -08:00
+    { 10457400, 1, 1 }, // 2025-08-28 07:55:00 -08:00
+    { 10486500, 0, 0 }, // 2025-08-28 16:00:00 -08:00
+    { 10518900, 0, 1 }, // 2025-08-29 01:00:00 -08:00
+    { 10543800, 1, 1 }, // 2025-08-29 07:55:00 -08:00
+    { 10572900, 0, 0 }, // 2025-08-29 16:00:00 -08:00
+    { 10605300, 0, 1 }, // 2025-08-30 01:00:00 -08:00
+    { 10889400, 1, 1 }, // 2025-09-02 07:55:00 -08:00
+    { 10918500, 0, 0 }, // 2025-09-02 16:00:00 -08:00
+    { 10950900, 0, 1 }, // 2025-09-03 01:00:00 -08:00
+    { 10975800, 1, 1 }, // 2025-09-03 07:55:00 -08:00
+    { 11004900, 0, 0 }, // 2025-09-03 16:00:00 -08:00
+    { 11037300, 0, 1 }, // 2025-09-04 01:00:00 -08:00
+    { 11062200, 1, 1 }, // 2025-09-04 07:55:00 -08:00
+    { 11091300, 0, 0 }, // 2025-09-04 16:00:00 -08:00
+    { 11123700, 0, 1 }, // 2025-09-05 01:00:00 -08:00
+    { 11148600, 1, 1 }, // 2025-09-05 07:55:00 -08:00
+    { 11177700, 0, 0 }, // 2025-09-05 16:00:00 -08:00
+    { 11210100, 0, 1 }, // 2025-09-06 01:00:00 -08:00
+    { 11407800, 1, 1 }, // 2025-09-08 07:55:00 -08:00
+    { 11436900, 0, 0 }, // 2025-09-08 16:00:00 -08:00
+    { 11469300, 0, 1 }, // 2025-09-09 01:00:00 -08:00
+    { 11494200, 1, 1 }, // 2025-09-09 07:55:00 -08:00
+    { 11523300, 0, 0 }, // 2025-09-09 16:00:00 -08:00
+    { 11555700, 0, 1 }, // 2025-09-10 01:00:00 -08:00
+    { 11580600, 1, 1 }, // 2025-09-10 07:55:00 -08:00
+    { 11609700, 0, 0 }, // 2025-09-10 16:00:00 -08:00
+    { 11642100, 0, 1 }, // 2025-09-11 01:00:00 -08:00
+    { 11667000, 1, 1 }, // 2025-09-11 07:55:00 -08:00
+    { 11696100, 0, 0 }, // 2025-09-11 16:00:00 -08:00
+    { 11728500, 0, 1 }, // 2025-09-12 01:00:00 -08:00
+    { 11753400, 1, 1 }, // 2025-09-12 07:55:00 -08:00
+    { 11782500, 0, 0 }, // 2025-09-12 16:00:00 -08:00
+    { 11814900, 0, 1 }, // 2025-09-13 01:00:00 -08:00
+    { 12099000, 1, 1 }, // 2025-09-16 07:55:00 -08:00
+    { 12128100, 0, 0 }, // 2025-09-16 16:00:00 -08:00
+    { 12160500, 0, 1 }, // 2025-09-17 01:00:00 -08:00
+    { 12185400, 1, 1 }, // 2025-09-17 07:55:00 -08:00
+    { 12214500, 0, 0 }, // 2025-09-17 16:00:00 -08:00
+    { 12246900, 0, 1 }, // 2025-09-18 01:00:00 -08:00
+    { 12271800, 1, 1 }, // 2025-09-18 07:55:00 -08:00
+    { 12300900, 0, 0 }, // 2025-09-18 16:00:00 -08:00
+    { 12333300, 0, 1 }, // 2025-09-19 01:00:00 -08:00
+    { 12358200, 1, 1 }, // 2025-09-19 07:55:00 -08:00
+    { 12387300, 0, 0 }, // 2025-09-19 16:00:00 -08:00
+    { 12419700, 0, 1 }, // 2025-09-20 01:00:00 -08:00
+    { 12617400, 1, 1 }, // 2025-09-22 07:55:00 -08:00
+    { 12646500, 0, 0 }, // 2025-09-22 16:00:00 -08:00
+    { 12678900, 0, 1 }, // 2025-09-23 01:00:00 -08:00
+    { 12703800, 1, 1 }, // 2025-09-23 07:55:00 -08:00
+    { 12732900, 0, 0 }, // 2025-09-23 16:00:00 -08:00
+    { 12765300, 0, 1 }, // 2025-09-24 01:00:00 -08:00
+    { 12790200, 1, 1 }, // 2025-09-24 07:55:00 -08:00
+    { 12819300, 0, 0 }, // 2025-09-24 16:00:00 -08:00
+    { 12851700, 0, 1 }, // 2025-09-25 01:00:00 -08:00
+    { 12876600, 1, 1 }, // 2025-09-25 07:55:00 -08:00
+    { 12905700, 0, 0 }, // 2025-09-25 16:00:00 -08:00
+    { 12938100, 0, 1 }, // 2025-09-26 01:00:00 -08:00
+    { 12963000, 1, 1 }, // 2025-09-26 07:55:00 -08:00
+    { 12992100, 0, 0 }, // 2025-09-26 16:00:00 -08:00
+    { 13024500, 0, 1 }, // 2025-09-27 01:00:00 -08:00
+    { 13222200, 1, 1 }, // 2025-09-29 07:55:00 -08:00
+    { 13251300, 0, 0 }, // 2025-09-29 16:00:00 -08:00
+    { 13283700, 0, 1 }, // 2025-09-30 01:00:00 -08:00
+    { 13308600, 1, 1 }, // 2025-09-30 07:55:00 -08:00
+    { 13337700, 0, 0 }, // 2025-09-30 16:00:00 -08:00
+    { 13370100, 0, 1 }, // 2025-10-01 01:00:00 -08:00
+    { 13395000, 1, 1 }, // 2025-10-01 07:55:00 -08:00
+    { 13424100, 0, 0 }, // 2025-10-01 16:00:00 -08:00
+    { 13456500, 0, 1 }, // 2025-10-02 01:00:00 -08:00
+    { 13481400, 1, 1 }, // 2025-10-02 07:55:00 -08:00
+    { 13510500, 0, 0 }, // 2025-10-02 16:00:00 -08:00
+    { 13542900, 0, 1 }, // 2025-10-03 01:00:00 -08:00
+    { 13567800, 1, 1 }, // 2025-10-03 07:55:00 -08:00
+    { 13596900, 0, 0 }, // 2025-10-03 16:00:00 -08:00
+    { 13629300, 0, 1 }, // 2025-10-04 01:00:00 -08:00
+    { 13827000, 1, 1 }, // 2025-10-06 07:55:00 -08:00
+    { 13856100, 0, 0 }, // 2025-10-06 16:00:00 -08:00
+    { 13888500, 0, 1 }, // 2025-10-07 01:00:00 -08:00
+    { 13913400, 1, 1 }, // 2025-10-07 07:55:00 -08:00
+    { 13942500, 0, 0 }, // 2025-10-07 16:00:00 -08:00
+    { 13974900, 0, 1 }, // 2025-10-08 01:00:00 -08:00
+    { 13999800, 1, 1 }, // 2025-10-08 07:55:00 -08:00
+    { 14028900, 0, 0 }, // 2025-10-08 16:00:00 -08:00
+    { 14061300, 0, 1 }, // 2025-10-09 01:00:00 -08:00
+    { 14086200, 1, 1 }, // 2025-10-09 07:55:00 -08:00
+    { 14115300, 0, 0 }, // 2025-10-09 16:00:00 -08:00
+    { 14147700, 0, 1 }, // 2025-10-10 01:00:00 -08:00
+    { 14172600, 1, 1 }, // 2025-10-10 07:55:00 -08:00
+    { 14201700, 0, 0 }, // 2025-10-10 16:00:00 -08:00
+    { 14234100, 0, 1 }, // 2025-10-11 01:00:00 -08:00
+    { 14431800, 1, 1 }, // 2025-10-13 07:55:00 -08:00
+    { 14460900, 0, 0 }, // 2025-10-13 16:00:00 -08:00
+    { 14493300, 0, 1 }, // 2025-10-14 01:00:00 -08:00
+    { 14518200, 1, 1 }, // 2025-10-14 07:55:00 -08:00
+    { 14547300, 0, 0 }, // 2025-10-14 16:00:00 -08:00
+    { 14579700, 0, 1 }, // 2025-10-15 01:00:00 -08:00
+    { 14604600, 1, 1 }, // 2025-10-15 07:55:00 -08:00
+    { 14633700, 0, 0 }, // 2025-10-15 16:00:00 -08:00
+    { 14666100, 0, 1 }, // 2025-10-16 01:00:00 -08:00
+    { 14691000, 1, 1 }, // 2025-10-16 07:55:00 -08:00
+    { 14720100, 0, 0 }, // 2025-10-16 16:00:00 -08:00
+    { 14752500, 0, 1 }, // 2025-10-17 01:00:00 -08:00
+    { 14777400, 1, 1 }, // 2025-10-17 07:55:00 -08:00
+    { 14806500, 0, 0 }, // 2025-10-17 16:00:00 -08:00
+    { 14838900, 0, 1 }, // 2025-10-18 01:00:00 -08:00
+    { 15036600, 1, 1 }, // 2025-10-20 07:55:00 -08:00
+    { 15065700, 0, 0 }, // 2025-10-20 16:00:00 -08:00
+    { 15098100, 0, 1 }, // 2025-10-21 01:00:00 -08:00
+    { 15123000, 1, 1 }, // 2025-10-21 07:55:00 -08:00
+    { 15152100, 0, 0 }, // 2025-10-21 16:00:00 -08:00
+    { 15184500, 0, 1 }, // 2025-10-22 01:00:00 -08:00
+    { 15209400, 1, 1 }, // 2025-10-22 07:55:00 -08:00
+    { 15238500, 0, 0 }, // 2025-10-22 16:00:00 -08:00
+    { 15270900, 0, 1 }, // 2025-10-23 01:00:00 -08:00
+    { 15295800, 1, 1 }, // 2025-10-23 07:55:00 -08:00
+    { 15324900, 0, 0 }, // 2025-10-23 16:00:00 -08:00
+    { 15357300, 0, 1 }, // 2025-10-24 01:00:00 -08:00
+    { 15382200, 1, 1 }, // 2025-10-24 07:55:00 -08:00
+    { 15411300, 0, 0 }, // 2025-10-24 16:00:00 -08:00
+    { 15443700, 0, 1 }, // 2025-10-25 01:00:00 -08:00
+    { 15641400, 1, 1 }, // 2025-10-27 07:55:00 -08:00
+    { 15670500, 0, 0 }, // 2025-10-27 16:00:00 -08:00
+    { 15702900, 0, 1 }, // 2025-10-28 01:00:00 -08:00
+    { 15727800, 1, 1 }, // 2025-10-28 07:55:00 -08:00
+    { 15756900, 0, 0 }, // 2025-10-28 16:00:00 -08:00
+    { 15789300, 0, 1 }, // 2025-10-29 01:00:00 -08:00
+    { 15814200, 1, 1 }, // 2025-10-29 07:55:00 -08:00
+    { 15843300, 0, 0 }, // 2025-10-29 16:00:00 -08:00
+    { 15875700, 0, 1 }, // 2025-10-30 01:00:00 -08:00
+    { 15900600, 1, 1 }, // 2025-10-30 07:55:00 -08:00
+    { 15929700, 0, 0 }, // 2025-10-30 16:00:00 -08:00
+    { 15962100, 0, 1 }, // 2025-10-31 01:00:00 -08:00
+    { 15987000, 1, 1 }, // 2025-10-31 07:55:00 -08:00
+    { 16016100, 0, 0 }, // 2025-10-31 16:00:00 -08:00
+    { 16048500, 0, 1 }, // 2025-11-01 01:00:00 -08:00
+    { 16336200, 1, 1 }, // 2025-11-04 07:55:00 -09:00
+    { 16365300, 0, 0 }, // 2025-11-04 16:00:00 -09:00
+    { 16397700, 0, 1 }, // 2025-11-05 01:00:00 -09:00
+    { 16422600, 1, 1 }, // 2025-11-05 07:55:00 -09:00
+    { 16451700, 0, 0 }, // 2025-11-05 16:00:00 -09:00
+    { 16484100, 0, 1 }, // 2025-11-06 01:00:00 -09:00
+    { 16509000, 1, 1 }, // 2025-11-06 07:55:00 -09:00
+    { 16538100, 0, 0 }, // 2025-11-06 16:00:00 -09:00
+    { 16570500, 0, 1 }, // 2025-11-07 01:00:00 -09:00
+    { 16595400, 1, 1 }, // 2025-11-07 07:55:00 -09:00
+    { 16624500, 0, 0 }, // 2025-11-07 16:00:00 -09:00
+    { 16656900, 0, 1 }, // 2025-11-08 01:00:00 -09:00
+    { 16938000, 1, 1 }, // 2025-11-11 07:05:00 -09:00
+    { 16938300, 0, 1 }, // 2025-11-11 07:10:00 -09:00
+    { 17027400, 1, 1 }, // 2025-11-12 07:55:00 -09:00
+    { 17056500, 0, 0 }, // 2025-11-12 16:00:00 -09:00
+    { 17088900, 0, 1 }, // 2025-11-13 01:00:00 -09:00
+    { 17113800, 1, 1 }, // 2025-11-13 07:55:00 -09:00
+    { 17142900, 0, 0 }, // 2025-11-13 16:00:00 -09:00
+    { 17175300, 0, 1 }, // 2025-11-14 01:00:00 -09:00
+    { 17200200, 1, 1 }, // 2025-11-14 07:55:00 -09:00
+    { 17229300, 0, 0 }, // 2025-11-14 16:00:00 -09:00
+    { 17261700, 0, 1 }, // 2025-11-15 01:00:00 -09:00
+    { 17459400, 1, 1 }, // 2025-11-17 07:55:00 -09:00
+    { 17488500, 0, 0 }, // 2025-11-17 16:00:00 -09:00
+    { 17520900, 0, 1 }, // 2025-11-18 01:00:00 -09:00
+    { 17545800, 1, 1 }, // 2025-11-18 07:55:00 -09:00
+    { 17574900, 0, 0 }, // 2025-11-18 16:00:00 -09:00
+    { 17607300, 0, 1 }, // 2025-11-19 01:00:00 -09:00
+    { 17632200, 1, 1 }, // 2025-11-19 07:55:00 -09:00
+    { 17661300, 0, 0 }, // 2025-11-19 16:00:00 -09:00
+    { 17693700, 0, 1 }, // 2025-11-20 01:00:00 -09:00
+    { 17718600, 1, 1 }, // 2025-11-20 07:55:00 -09:00
+    { 17747700, 0, 0 }, // 2025-11-20 16:00:00 -09:00
+    { 17780100, 0, 1 }, // 2025-11-21 01:00:00 -09:00
+    { 17805000, 1, 1 }, // 2025-11-21 07:55:00 -09:00
+    { 17834100, 0, 0 }, // 2025-11-21 16:00:00 -09:00
+    { 17866500, 0, 1 }, // 2025-11-22 01:00:00 -09:00
+    { 18064200, 1, 1 }, // 2025-11-24 07:55:00 -09:00
+    { 18093300, 0, 0 }, // 2025-11-24 16:00:00 -09:00
+    { 18125700, 0, 1 }, // 2025-11-25 01:00:00 -09:00
+    { 18150600, 1, 1 }, // 2025-11-25 07:55:00 -09:00
+    { 18179700, 0, 0 }, // 2025-11-25 16:00:00 -09:00
+    { 18212100, 0, 1 }, // 2025-11-26 01:00:00 -09:00
+    { 18237000, 1, 1 }, // 2025-11-26 07:55:00 -09:00
+    { 18266100, 0, 0 }, // 2025-11-26 16:00:00 -09:00
+    { 18298500, 0, 1 }, // 2025-11-27 01:00:00 -09:00
+    { 18669000, 1, 1 }, // 2025-12-01 07:55:00 -09:00
+    { 18698100, 0, 0 }, // 2025-12-01 16:00:00 -09:00
+    { 18730500, 0, 1 }, // 2025-12-02 01:00:00 -09:00
+    { 18755400, 1, 1 }, // 2025-12-02 07:55:00 -09:00
+    { 18784500, 0, 0 }, // 2025-12-02 16:00:00 -09:00
+    { 18816900, 0, 1 }, // 2025-12-03 01:00:00 -09:00
+    { 18841800, 1, 1 }, // 2025-12-03 07:55:00 -09:00
+    { 18870900, 0, 0 }, // 2025-12-03 16:00:00 -09:00
+    { 18903300, 0, 1 }, // 2025-12-04 01:00:00 -09:00
+    { 18928200, 1, 1 }, // 2025-12-04 07:55:00 -09:00
+    { 18957300, 0, 0 }, // 2025-12-04 16:00:00 -09:00
+    { 18989700, 0, 1 }, // 2025-12-05 01:00:00 -09:00
+    { 19014600, 1, 1 }, // 2025-12-05 07:55:00 -09:00
+    { 19043700, 0, 0 }, // 2025-12-05 16:00:00 -09:00
+    { 19076100, 0, 1 }, // 2025-12-06 01:00:00 -09:00
+    { 19273800, 1, 1 }, // 2025-12-08 07:55:00 -09:00
+    { 19302900, 0, 0 }, // 2025-12-08 16:00:00 -09:00
+    { 19335300, 0, 1 }, // 2025-12-09 01:00:00 -09:00
+    { 19360200, 1, 1 }, // 2025-12-09 07:55:00 -09:00
+    { 19389300, 0, 0 }, // 2025-12-09 16:00:00 -09:00
+    { 19421700, 0, 1 }, // 2025-12-10 01:00:00 -09:00
+    { 19446600, 1, 1 }, // 2025-12-10 07:55:00 -09:00
+    { 19475700, 0, 0 }, // 2025-12-10 16:00:00 -09:00
+    { 19508100, 0, 1 }, // 2025-12-11 01:00:00 -09:00
+    { 19533000, 1, 1 }, // 2025-12-11 07:55:00 -09:00
+    { 19562100, 0, 0 }, // 2025-12-11 16:00:00 -09:00
+    { 19594500, 0, 1 }, // 2025-12-12 01:00:00 -09:00
+    { 19619400, 1, 1 }, // 2025-12-12 07:55:00 -09:00
+    { 19648500, 0, 0 }, // 2025-12-12 16:00:00 -09:00
+    { 19680900, 0, 1 }, // 2025-12-13 01:00:00 -09:00
+    { 19878600, 1, 1 }, // 2025-12-15 07:55:00 -09:00
+    { 19907700, 0, 0 }, // 2025-12-15 16:00:00 -09:00
+    { 19940100, 0, 1 }, // 2025-12-16 01:00:00 -09:00
+    { 19965000, 1, 1 }, // 2025-12-16 07:55:00 -09:00
+    { 19994100, 0, 0 }, // 2025-12-16 16:00:00 -09:00
+    { 20026500, 0, 1 }, // 2025-12-17 01:00:00 -09:00
+    { 20051400, 1, 1 }, // 2025-12-17 07:55:00 -09:00
+    { 20080500, 0, 0 }, // 2025-12-17 16:00:00 -09:00
+    { 20112900, 0, 1 }, // 2025-12-18 01:00:00 -09:00
+    { 20137800, 1, 1 }, // 2025-12-18 07:55:00 -09:00
+    { 20166900, 0, 0 }, // 2025-12-18 16:00:00 -09:00
+    { 20199300, 0, 1 }, // 2025-12-19 01:00:00 -09:00
+    { 20566800, 1, 1 }, // 2025-12-23 07:05:00 -09:00
+    { 20567100, 0, 1 }, // 2025-12-23 07:10:00 -09:00
+    { 21171600, 1, 1 }, // 2025-12-30 07:05:00 -09:00
+    { 21171900, 0, 1 }, // 2025-12-30 07:10:00 -09:00
+    { 21693000, 1, 1 }, // 2026-01-05 07:55:00 -09:00
+    { 21722100, 0, 0 }, // 2026-01-05 16:00:00 -09:00
+    { 21754500, 0, 1 }, // 2026-01-06 01:00:00 -09:00
+    { 21779400, 1, 1 }, // 2026-01-06 07:55:00 -09:00
+    { 21808500, 0, 0 }, // 2026-01-06 16:00:00 -09:00
+    { 21840900, 0, 1 }, // 2026-01-07 01:00:00 -09:00
+    { 21865800, 1, 1 }, // 2026-01-07 07:55:00 -09:00
+    { 21894900, 0, 0 }, // 2026-01-07 16:00:00 -09:00
+    { 21927300, 0, 1 }, // 2026-01-08 01:00:00 -09:00
+    { 21952200, 1, 1 }, // 2026-01-08 07:55:00 -09:00
+    { 21981300, 0, 0 }, // 2026-01-08 16:00:00 -09:00
+    { 22013700, 0, 1 }, // 2026-01-09 01:00:00 -09:00
+    { 22038600, 1, 1 }, // 2026-01-09 07:55:00 -09:00
+    { 22067700, 0, 0 }, // 2026-01-09 16:00:00 -09:00
+    { 22100100, 0, 1 }, // 2026-01-10 01:00:00 -09:00
+    { 22297800, 1, 1 }, // 2026-01-12 07:55:00 -09:00
+    { 22326900, 0, 0 }, // 2026-01-12 16:00:00 -09:00
+    { 22359300, 0, 1 }, // 2026-01-13 01:00:00 -09:00
+    { 22384200, 1, 1 }, // 2026-01-13 07:55:00 -09:00
+    { 22413300, 0, 0 }, // 2026-01-13 16:00:00 -09:00
+    { 22445700, 0, 1 }, // 2026-01-14 01:00:00 -09:00
+    { 22470600, 1, 1 }, // 2026-01-14 07:55:00 -09:00
+    { 22499700, 0, 0 }, // 2026-01-14 16:00:00 -09:00
+    { 22532100, 0, 1 }, // 2026-01-15 01:00:00 -09:00
+    { 22557000, 1, 1 }, // 2026-01-15 07:55:00 -09:00
+    { 22586100, 0, 0 }, // 2026-01-15 16:00:00 -09:00
+    { 22618500, 0, 1 }, // 2026-01-16 01:00:00 -09:00
+    { 22643400, 1, 1 }, // 2026-01-16 07:55:00 -09:00
+    { 22672500, 0, 0 }, // 2026-01-16 16:00:00 -09:00
+    { 22704900, 0, 1 }, // 2026-01-17 01:00:00 -09:00
+    { 22989000, 1, 1 }, // 2026-01-20 07:55:00 -09:00
+    { 23018100, 0, 0 }, // 2026-01-20 16:00:00 -09:00
+    { 23050500, 0, 1 }, // 2026-01-21 01:00:00 -09:00
+    { 23075400, 1, 1 }, // 2026-01-21 07:55:00 -09:00
+    { 23104500, 0, 0 }, // 2026-01-21 16:00:00 -09:00
+    { 23136900, 0, 1 }, // 2026-01-22 01:00:00 -09:00
+    { 23161800, 1, 1 }, // 2026-01-22 07:55:00 -09:00
+    { 23190900, 0, 0 }, // 2026-01-22 16:00:00 -09:00
+    { 23223300, 0, 1 }, // 2026-01-23 01:00:00 -09:00
+    { 23248200, 1, 1 }, // 2026-01-23 07:55:00 -09:00
+    { 23277300, 0, 0 }, // 2026-01-23 16:00:00 -09:00
+    { 23309700, 0, 1 }, // 2026-01-24 01:00:00 -09:00
+    { 23507400, 1, 1 }, // 2026-01-26 07:55:00 -09:00
+    { 23536500, 0, 0 }, // 2026-01-26 16:00:00 -09:00
+    { 23568900, 0, 1 }, // 2026-01-27 01:00:00 -09:00
+    { 23593800, 1, 1 }, // 2026-01-27 07:55:00 -09:00
+    { 23622900, 0, 0 }, // 2026-01-27 16:00:00 -09:00
+    { 23655300, 0, 1 }, // 2026-01-28 01:00:00 -09:00
+    { 23680200, 1, 1 }, // 2026-01-28 07:55:00 -09:00
+    { 23709300, 0, 0 }, // 2026-01-28 16:00:00 -09:00
+    { 23741700, 0, 1 }, // 2026-01-29 01:00:00 -09:00
+    { 23766600, 1, 1 }, // 2026-01-29 07:55:00 -09:00
+    { 23795700, 0, 0 }, // 2026-01-29 16:00:00 -09:00
+    { 23828100, 0, 1 }, // 2026-01-30 01:00:00 -09:00
+    { 23853000, 1, 1 }, // 2026-01-30 07:55:00 -09:00
+    { 23882100, 0, 0 }, // 2026-01-30 16:00:00 -09:00
+    { 23914500, 0, 1 }, // 2026-01-31 01:00:00 -09:00
+    { 24112200, 1, 1 }, // 2026-02-02 07:55:00 -09:00
+    { 24141300, 0, 0 }, // 2026-02-02 16:00:00 -09:00
+    { 24173700, 0, 1 }, // 2026-02-03 01:00:00 -09:00
+    { 24198600, 1, 1 }, // 2026-02-03 07:55:00 -09:00
+    { 24227700, 0, 0 }, // 2026-02-03 16:00:00 -09:00
+    { 24260100, 0, 1 }, // 2026-02-04 01:00:00 -09:00
+    { 24285000, 1, 1 }, // 2026-02-04 07:55:00 -09:00
+    { 24314100, 0, 0 }, // 2026-02-04 16:00:00 -09:00
+    { 24346500, 0, 1 }, // 2026-02-05 01:00:00 -09:00
+    { 24371400, 1, 1 }, // 2026-02-05 07:55:00 -09:00
+    { 24400500, 0, 0 }, // 2026-02-05 16:00:00 -09:00
+    { 24432900, 0, 1 }, // 2026-02-06 01:00:00 -09:00
+    { 24457800, 1, 1 }, // 2026-02-06 07:55:00 -09:00
+    { 24486900, 0, 0 }, // 2026-02-06 16:00:00 -09:00
+    { 24519300, 0, 1 }, // 2026-02-07 01:00:00 -09:00
+    { 24803400, 1, 1 }, // 2026-02-10 07:55:00 -09:00
+    { 24832500, 0, 0 }, // 2026-02-10 16:00:00 -09:00
+    { 24864900, 0, 1 }, // 2026-02-11 01:00:00 -09:00
+    { 24889800, 1, 1 }, // 2026-02-11 07:55:00 -09:00
+    { 24918900, 0, 0 }, // 2026-02-11 16:00:00 -09:00
+    { 24951300, 0, 1 }, // 2026-02-12 01:00:00 -09:00
+    { 24976200, 1, 1 }, // 2026-02-12 07:55:00 -09:00
+    { 25005300, 0, 0 }, // 2026-02-12 16:00:00 -09:00
+    { 25037700, 0, 1 }, // 2026-02-13 01:00:00 -09:00
+    { 25062600, 1, 1 }, // 2026-02-13 07:55:00 -09:00
+    { 25091700, 0, 0 }, // 2026-02-13 16:00:00 -09:00
+    { 25124100, 0, 1 }, // 2026-02-14 01:00:00 -09:00
+    { 25408200, 1, 1 }, // 2026-02-17 07:55:00 -09:00
+    { 25437300, 0, 0 }, // 2026-02-17 16:00:00 -09:00
+    { 25469700, 0, 1 }, // 2026-02-18 01:00:00 -09:00
+    { 25494600, 1, 1 }, // 2026-02-18 07:55:00 -09:00
+    { 25523700, 0, 0 }, // 2026-02-18 16:00:00 -09:00
+    { 25556100, 0, 1 }, // 2026-02-19 01:00:00 -09:00
+    { 25581000, 1, 1 }, // 2026-02-19 07:55:00 -09:00
+    { 25610100, 0, 0 }, // 2026-02-19 16:00:00 -09:00
+    { 25642500, 0, 1 }, // 2026-02-20 01:00:00 -09:00
+    { 25667400, 1, 1 }, // 2026-02-20 07:55:00 -09:00
+    { 25696500, 0, 0 }, // 2026-02-20 16:00:00 -09:00
+    { 25728900, 0, 1 }, // 2026-02-21 01:00:00 -09:00
+    { 25926600, 1, 1 }, // 2026-02-23 07:55:00 -09:00
+    { 25955700, 0, 0 }, // 2026-02-23 16:00:00 -09:00
+    { 25988100, 0, 1 }, // 2026-02-24 01:00:00 -09:00
+    { 26013000, 1, 1 }, // 2026-02-24 07:55:00 -09:00
+    { 26042100, 0, 0 }, // 2026-02-24 16:00:00 -09:00
+    { 26074500, 0, 1 }, // 2026-02-25 01:00:00 -09:00
+    { 26099400, 1, 1 }, // 2026-02-25 07:55:00 -09:00
+    { 26128500, 0, 0 }, // 2026-02-25 16:00:00 -09:00
+    { 26160900, 0, 1 }, // 2026-02-26 01:00:00 -09:00
+    { 26185800, 1, 1 }, // 2026-02-26 07:55:00 -09:00
+    { 26214900, 0, 0 }, // 2026-02-26 16:00:00 -09:00
+    { 26247300, 0, 1 }, // 2026-02-27 01:00:00 -09:00
+    { 26272200, 1, 1 }, // 2026-02-27 07:55:00 -09:00
+    { 26301300, 0, 0 }, // 2026-02-27 16:00:00 -09:00
+    { 26333700, 0, 1 }, // 2026-02-28 01:00:00 -09:00
+    { 26531400, 1, 1 }, // 2026-03-02 07:55:00 -09:00
+    { 26560500, 0, 0 }, // 2026-03-02 16:00:00 -09:00
+    { 26592900, 0, 1 }, // 2026-03-03 01:00:00 -09:00
+    { 26617800, 1, 1 }, // 2026-03-03 07:55:00 -09:00
+    { 26646900, 0, 0 }, // 2026-03-03 16:00:00 -09:00
+    { 26679300, 0, 1 }, // 2026-03-04 01:00:00 -09:00
+    { 26704200, 1, 1 }, // 2026-03-04 07:55:00 -09:00
+    { 26733300, 0, 0 }, // 2026-03-04 16:00:00 -09:00
+    { 26765700, 0, 1 }, // 2026-03-05 01:00:00 -09:00
+    { 26790600, 1, 1 }, // 2026-03-05 07:55:00 -09:00
+    { 26819700, 0, 0 }, // 2026-03-05 16:00:00 -09:00
+    { 26852100, 0, 1 }, // 2026-03-06 01:00:00 -09:00
+    { 27216000, 1, 1 }, // 2026-03-10 07:05:00 -08:00
+    { 27216300, 0, 1 }, // 2026-03-10 07:10:00 -08:00
+    { 27737400, 1, 1 }, // 2026-03-16 07:55:00 -08:00
+    { 27766500, 0, 0 }, // 2026-03-16 16:00:00 -08:00
+    { 27798900, 0, 1 }, // 2026-03-17 01:00:00 -08:00
+    { 27823800, 1, 1 }, // 2026-03-17 07:55:00 -08:00
+    { 27852900, 0, 0 }, // 2026-03-17 16:00:00 -08:00
+    { 27885300, 0, 1 }, // 2026-03-18 01:00:00 -08:00
+    { 27910200, 1, 1 }, // 2026-03-18 07:55:00 -08:00
+    { 27939300, 0, 0 }, // 2026-03-18 16:00:00 -08:00
+    { 27971700, 0, 1 }, // 2026-03-19 01:00:00 -08:00
+    { 27996600, 1, 1 }, // 2026-03-19 07:55:00 -08:00
+    { 28025700, 0, 0 }, // 2026-03-19 16:00:00 -08:00
+    { 28058100, 0, 1 }, // 2026-03-20 01:00:00 -08:00
+    { 28083000, 1, 1 }, // 2026-03-20 07:55:00 -08:00
+    { 28112100, 0, 0 }, // 2026-03-20 16:00:00 -08:00
+    { 28144500, 0, 1 }, // 2026-03-21 01:00:00 -08:00
+    { 28342200, 1, 1 }, // 2026-03-23 07:55:00 -08:00
+    { 28371300, 0, 0 }, // 2026-03-23 16:00:00 -08:00
+    { 28403700, 0, 1 }, // 2026-03-24 01:00:00 -08:00
+    { 28428600, 1, 1 }, // 2026-03-24 07:55:00 -08:00
+    { 28457700, 0, 0 }, // 2026-03-24 16:00:00 -08:00
+    { 28490100, 0, 1 }, // 2026-03-25 01:00:00 -08:00
+    { 28515000, 1, 1 }, // 2026-03-25 07:55:00 -08:00
+    { 28544100, 0, 0 }, // 2026-03-25 16:00:00 -08:00
+    { 28576500, 0, 1 }, // 2026-03-26 01:00:00 -08:00
+    { 28601400, 1, 1 }, // 2026-03-26 07:55:00 -08:00
+    { 28630500, 0, 0 }, // 2026-03-26 16:00:00 -08:00
+    { 28662900, 0, 1 }, // 2026-03-27 01:00:00 -08:00
+    { 28687800, 1, 1 }, // 2026-03-27 07:55:00 -08:00
+    { 28716900, 0, 0 }, // 2026-03-27 16:00:00 -08:00
+    { 28749300, 0, 1 }, // 2026-03-28 01:00:00 -08:00
+    { 28947000, 1, 1 }, // 2026-03-30 07:55:00 -08:00
+    { 28976100, 0, 0 }, // 2026-03-30 16:00:00 -08:00
+    { 29008500, 0, 1 }, // 2026-03-31 01:00:00 -08:00
+    { 29033400, 1, 1 }, // 2026-03-31 07:55:00 -08:00
+    { 29062500, 0, 0 }, // 2026-03-31 16:00:00 -08:00
+    { 29094900, 0, 1 }, // 2026-04-01 01:00:00 -08:00
+    { 29119800, 1, 1 }, // 2026-04-01 07:55:00 -08:00
+    { 29148900, 0, 0 }, // 2026-04-01 16:00:00 -08:00
+    { 29181300, 0, 1 }, // 2026-04-02 01:00:00 -08:00
+    { 29206200, 1, 1 }, // 2026-04-02 07:55:00 -08:00
+    { 29235300, 0, 0 }, // 2026-04-02 16:00:00 -08:00
+    { 29267700, 0, 1 }, // 2026-04-03 01:00:00 -08:00
+    { 29292600, 1, 1 }, // 2026-04-03 07:55:00 -08:00
+    { 29321700, 0, 0 }, // 2026-04-03 16:00:00 -08:00
+    { 29354100, 0, 1 }, // 2026-04-04 01:00:00 -08:00
+    { 29551800, 1, 1 }, // 2026-04-06 07:55:00 -08:00
+    { 29580900, 0, 0 }, // 2026-04-06 16:00:00 -08:00
+    { 29613300, 0, 1 }, // 2026-04-07 01:00:00 -08:00
+    { 29638200, 1, 1 }, // 2026-04-07 07:55:00 -08:00
+    { 29667300, 0, 0 }, // 2026-04-07 16:00:00 -08:00
+    { 29699700, 0, 1 }, // 2026-04-08 01:00:00 -08:00
+    { 29724600, 1, 1 }, // 2026-04-08 07:55:00 -08:00
+    { 29753700, 0, 0 }, // 2026-04-08 16:00:00 -08:00
+    { 29786100, 0, 1 }, // 2026-04-09 01:00:00 -08:00
+    { 29811000, 1, 1 }, // 2026-04-09 07:55:00 -08:00
+    { 29840100, 0, 0 }, // 2026-04-09 16:00:00 -08:00
+    { 29872500, 0, 1 }, // 2026-04-10 01:00:00 -08:00
+    { 29897400, 1, 1 }, // 2026-04-10 07:55:00 -08:00
+    { 29926500, 0, 0 }, // 2026-04-10 16:00:00 -08:00
+    { 29958900, 0, 1 }, // 2026-04-11 01:00:00 -08:00
+    { 30156600, 1, 1 }, // 2026-04-13 07:55:00 -08:00
+    { 30185700, 0, 0 }, // 2026-04-13 16:00:00 -08:00
+    { 30218100, 0, 1 }, // 2026-04-14 01:00:00 -08:00
+    { 30243000, 1, 1 }, // 2026-04-14 07:55:00 -08:00
+    { 30272100, 0, 0 }, // 2026-04-14 16:00:00 -08:00
+    { 30304500, 0, 1 }, // 2026-04-15 01:00:00 -08:00
+    { 30329400, 1, 1 }, // 2026-04-15 07:55:00 -08:00
+    { 30358500, 0, 0 }, // 2026-04-15 16:00:00 -08:00
+    { 30390900, 0, 1 }, // 2026-04-16 01:00:00 -08:00
+    { 30415800, 1, 1 }, // 2026-04-16 07:55:00 -08:00
+    { 30444900, 0, 0 }, // 2026-04-16 16:00:00 -08:00
+    { 30477300, 0, 1 }, // 2026-04-17 01:00:00 -08:00
+    { 30502200, 1, 1 }, // 2026-04-17 07:55:00 -08:00
+    { 30531300, 0, 0 }, // 2026-04-17 16:00:00 -08:00
+    { 30563700, 0, 1 }, // 2026-04-18 01:00:00 -08:00
+    { 30761400, 1, 1 }, // 2026-04-20 07:55:00 -08:00
+    { 30790500, 0, 0 }, // 2026-04-20 16:00:00 -08:00
+    { 30822900, 0, 1 }, // 2026-04-21 01:00:00 -08:00
+    { 30847800, 1, 1 }, // 2026-04-21 07:55:00 -08:00
+    { 30876900, 0, 0 }, // 2026-04-21 16:00:00 -08:00
+    { 30909300, 0, 1 }, // 2026-04-22 01:00:00 -08:00
+    { 30934200, 1, 1 }, // 2026-04-22 07:55:00 -08:00
+    { 30963300, 0, 0 }, // 2026-04-22 16:00:00 -08:00
+    { 30995700, 0, 1 }, // 2026-04-23 01:00:00 -08:00
+    { 31020600, 1, 1 }, // 2026-04-23 07:55:00 -08:00
+    { 31049700, 0, 0 }, // 2026-04-23 16:00:00 -08:00
+    { 31082100, 0, 1 }, // 2026-04-24 01:00:00 -08:00
+    { 31107000, 1, 1 }, // 2026-04-24 07:55:00 -08:00
+    { 31136100, 0, 0 }, // 2026-04-24 16:00:00 -08:00
+    { 31168500, 0, 1 }, // 2026-04-25 01:00:00 -08:00
+    { 31366200, 1, 1 }, // 2026-04-27 07:55:00 -08:00
+    { 31395300, 0, 0 }, // 2026-04-27 16:00:00 -08:00
+    { 31427700, 0, 1 }, // 2026-04-28 01:00:00 -08:00
+    { 31452600, 1, 1 }, // 2026-04-28 07:55:00 -08:00
+    { 31481700, 0, 0 }, // 2026-04-28 16:00:00 -08:00
+    { 31514100, 0, 1 }, // 2026-04-29 01:00:00 -08:00
+    { 31539000, 1, 1 }, // 2026-04-29 07:55:00 -08:00
+    { 31568100, 0, 0 }, // 2026-04-29 16:00:00 -08:00
+    { 31600500, 0, 1 }, // 2026-04-30 01:00:00 -08:00
+    { 31625400, 1, 1 }, // 2026-04-30 07:55:00 -08:00
+    { 31654500, 0, 0 }, // 2026-04-30 16:00:00 -08:00
+    { 31686900, 0, 1 }, // 2026-05-01 01:00:00 -08:00
+    { 31971000, 1, 1 }, // 2026-05-04 07:55:00 -08:00
+    { 32000100, 0, 0 }, // 2026-05-04 16:00:00 -08:00
+    { 32032500, 0, 1 }, // 2026-05-05 01:00:00 -08:00
+    { 32057400, 1, 1 }, // 2026-05-05 07:55:00 -08:00
+    { 32086500, 0, 0 }, // 2026-05-05 16:00:00 -08:00
+    { 32118900, 0, 1 }, // 2026-05-06 01:00:00 -08:00
+    { 32143800, 1, 1 }, // 2026-05-06 07:55:00 -08:00
+    { 32172900, 0, 0 }, // 2026-05-06 16:00:00 -08:00
+    { 32205300, 0, 1 }, // 2026-05-07 01:00:00 -08:00
+    { 32230200, 1, 1 }, // 2026-05-07 07:55:00 -08:00
+    { 32259300, 0, 0 }, // 2026-05-07 16:00:00 -08:00
+    { 32291700, 0, 1 }, // 2026-05-08 01:00:00 -08:00
+    { 32316600, 1, 1 }, // 2026-05-08 07:55:00 -08:00
+    { 32345700, 0, 0 }, // 2026-05-08 16:00:00 -08:00
+    { 32378100, 0, 1 }, // 2026-05-09 01:00:00 -08:00
+    { 32575800, 1, 1 }, // 2026-05-11 07:55:00 -08:00
+    { 32604900, 0, 0 }, // 2026-05-11 16:00:00 -08:00
+    { 32637300, 0, 1 }, // 2026-05-12 01:00:00 -08:00
+    { 32662200, 1, 1 }, // 2026-05-12 07:55:00 -08:00
+    { 32691300, 0, 0 }, // 2026-05-12 16:00:00 -08:00
+    { 32723700, 0, 1 }, // 2026-05-13 01:00:00 -08:00
+    { 32748600, 1, 1 }, // 2026-05-13 07:55:00 -08:00
+    { 32777700, 0, 0 }, // 2026-05-13 16:00:00 -08:00
+    { 32810100, 0, 1 }, // 2026-05-14 01:00:00 -08:00
+    { 32835000, 1, 1 }, // 2026-05-14 07:55:00 -08:00
+    { 32864100, 0, 0 }, // 2026-05-14 16:00:00 -08:00
+    { 32896500, 0, 1 }, // 2026-05-15 01:00:00 -08:00
+    { 32921400, 1, 1 }, // 2026-05-15 07:55:00 -08:00
+    { 32950500, 0, 0 }, // 2026-05-15 16:00:00 -08:00
+    { 32982900, 0, 1 }, // 2026-05-16 01:00:00 -08:00
+    { 33180600, 1, 1 }, // 2026-05-18 07:55:00 -08:00
+    { 33209700, 0, 0 }, // 2026-05-18 16:00:00 -08:00
+    { 33242100, 0, 1 }, // 2026-05-19 01:00:00 -08:00
+    { 33267000, 1, 1 }, // 2026-05-19 07:55:00 -08:00
+    { 33296100, 0, 0 }, // 2026-05-19 16:00:00 -08:00
+    { 33328500, 0, 1 }, // 2026-05-20 01:00:00 -08:00
+    { 33353400, 1, 1 }, // 2026-05-20 07:55:00 -08:00
+    { 33382500, 0, 0 }, // 2026-05-20 16:00:00 -08:00
+    { 33414900, 0, 1 }, // 2026-05-21 01:00:00 -08:00
+    { 33439800, 1, 1 }, // 2026-05-21 07:55:00 -08:00
+    { 33468900, 0, 0 }, // 2026-05-21 16:00:00 -08:00
+    { 33501300, 0, 1 }, // 2026-05-22 01:00:00 -08:00
+    { 33526200, 1, 1 }, // 2026-05-22 07:55:00 -08:00
+    { 33555300, 0, 0 }, // 2026-05-22 16:00:00 -08:00
+    { 33587700, 0, 1 }, // 2026-05-23 01:00:00 -08:00
+    { 33868800, 1, 1 }, // 2026-05-26 07:05:00 -08:00
+    { 33869100, 0, 1 }, // 2026-05-26 07:10:00 -08:00
+    { 34473600, 1, 1 }, // 2026-06-02 07:05:00 -08:00
+    { 34473900, 0, 1 }, // 2026-06-02 07:10:00 -08:00
+    { 35078400, 1, 1 }, // 2026-06-09 07:05:00 -08:00
+    { 35078700, 0, 1 }, // 2026-06-09 07:10:00 -08:00
+    { 35683200, 1, 1 }, // 2026-06-16 07:05:00 -08:00
+    { 35683500, 0, 1 }, // 2026-06-16 07:10:00 -08:00
+    { 36288000, 1, 1 }, // 2026-06-23 07:05:00 -08:00
+    { 36288300, 0, 1 }, // 2026-06-23 07:10:00 -08:00
+    { 36892800, 1, 1 }, // 2026-06-30 07:05:00 -08:00
+    { 36893100, 0, 1 }, // 2026-06-30 07:10:00 -08:00
+    { 37497600, 1, 1 }, // 2026-07-07 07:05:00 -08:00
+    { 37497900, 0, 1 }, // 2026-07-07 07:10:00 -08:00
+    { 38102400, 1, 1 }, // 2026-07-14 07:05:00 -08:00
+    { 38102700, 0, 1 }, // 2026-07-14 07:10:00 -08:00
+    { 38707200, 1, 1 }, // 2026-07-21 07:05:00 -08:00
+    { 38707500, 0, 1 }, // 2026-07-21 07:10:00 -08:00
+    { 39312000, 1, 1 }, // 2026-07-28 07:05:00 -08:00
+    { 39312300, 0, 1 }, // 2026-07-28 07:10:00 -08:00
+    { 39916800, 1, 1 }, // 2026-08-04 07:05:00 -08:00
+    { 39917100, 0, 1 }, // 2026-08-04 07:10:00 -08:00
+    { 40521600, 1, 1 }, // 2026-08-11 07:05:00 -08:00
+    { 40521900, 0, 1 }, // 2026-08-11 07:10:00 -08:00
+    { 41126400, 1, 1 }, // 2026-08-18 07:05:00 -08:00
+    { 41126700, 0, 1 }, // 2026-08-18 07:10:00 -08:00
+    { 41731200, 1, 1 }, // 2026-08-25 07:05:00 -08:00
+    { 41731500, 0, 1 }, // 2026-08-25 07:10:00 -08:00
+    { 42336000, 1, 1 }, // 2026-09-01 07:05:00 -08:00
+    { 42336300, 0, 1 }, // 2026-09-01 07:10:00 -08:00
+    { 42940800, 1, 1 }, // 2026-09-08 07:05:00 -08:00
+    { 42941100, 0, 1 }, // 2026-09-08 07:10:00 -08:00
+};
+static const uint32_t schedule_level_2_next_on[] = {
+       0,    2,    2,    4,    4,    6,    6,    8,    8,   10,   10,   12,   12,   14,   14,   16,
+      16,   18,   18,   20,   20,   22,   22,   24,   24,   26,   26,   28,   28,   30,   30,   32,
+      32,   35,   35,   35,   38,   38,   38,   41,   41,   41,   44,   44,   44,   47,   47,   47,
+      50,   50,   50,   53,   53,   53,   56,   56,   56,   59,   59,   59,   62,   62,   62,   65,
+      65,   65,   68,   68,   68,   71,   71,   71,   74,   74,   74,   77,   77,   77,   80,   80,
+      80,   83,   83,   83,   86,   86,   86,   89,   89,   89,   92,   92,   92,   95,   95,   95,
+      98,   98,   98,  101,  101,  101,  104,  104,  104,  107,  107,  107,  110,  110,  110,  113,
+     113,  113,  116,  116,  116,  119,  119,  119,  122,  122,  122,  125,  125,  125,  128,  128,
+     128,  131,  131,  131,  134,  134,  134,  137,  137,  137,  140,  140,  140,  143,  143,  143,
+     146,  146,  146,  149,  149,  149,  152,  152,  152,  155,  155,  155,  158,  158,  158,  161,
+     161,  161,  164,  164,  164,  167,  167,  167,  170,  170,  170,  173,  173,  173,  176,  176,
+     176,  179,  179,  179,  182,  182,  182,  185,  185,  185,  188,  188,  188,  191,  191,  191,
+     194,  194,  194,  197,  197,  197,  200,  200,  200,  203,  203,  203,  206,  206,  206,  209,
+     209,  209,  211,  211,  214,  214,  214,  217,  217,  217,  220,  220,  220,  223,  223,  223,
+     226,  226,  226,  229,  229,  229,  232,  232,  232,  235,  235,  235,  238,  238,  238,  241,
+     241,  241,  244,  244,  244,  247,  247,  247,  250,  250,  250,  253,  253,  253,  256,  256,
+     256,  259,  259,  259,  262,  262,  262,  265,  265,  265,  268,  268,  268,  271,  271,  271,
+     274,  274,  274,  277,  277,  277,  280,  280,  280,  283,  283,  283,  286,  286,  286,  288,
+     288,  290,  290,  293,  293,  293,  296,  296,  296,  299,  299,  299,  302,  302,  302,  305,
+     305,  305,  308,  308,  308,  311,  311,  311,  314,  314,  314,  317,  317,  317,  320,  320,
+     320,  323,  323,  323,  326,  326,  326,  329,  329,  329,  332,  332,  332,  335,  335,  335,
+     338,  338,  338,  341,  341,  341,  344,  344,  344,  347,  347,  347,  350,  350,  350,  353,
+     353,  353,  356,  356,  356,  359,  359,  359,  362,  362,  362,  365,  365,  365,  368,  368,
+     368,  371,  371,  371,  374,  374,  374,  377,  377,  377,  380,  380,  380,  383,  383,  383,
+     386,  386,  386,  389,  389,  389,  392,  392,  392,  395,  395,  395,  398,  398,  398,  401,
+     401,  401,  404,  404,  404,  407,  407,  407,  410,  410,  410,  413,  413,  413,  415,  415,
+     418,  418,  418,  421,  421,  421,  424,  424,  424,  427,  427,  427,  430,  430,  430,  433,
+     433,  433,  436,  436,  436,  439,  439,  439,  442,  442,  442,  445,  445,  445,  448,  448,
+     448,  451,  451,  451,  454,  454,  454,  457,  457,  457,  460,  460,  460,  463,  463,  463,
+     466,  466,  466,  469,  469,  469,  472,  472,  472,  475,  475,  475,  478,  478,  478,  481,
+     481,  481,  484,  484,  484,  487,  487,  487,  490,  490,  490,  493,  493,  493,  496,  496,
+     496,  499,  499,  499,  502,  502,  502,  505,  505,  505,  508,  508,  508,  511,  511,  511,
+     514,  514,  514,  517,  517,  517,  520,  520,  520,  523,  523,  523,  526,  526,  526,  529,
+     529,  529,  532,  532,  532,  535,  535,  535,  538,  538,  538,  541,  541,  541,  544,  544,
+     544,  547,  547,  547,  550,  550,  550,  553,  553,  553,  556,  556,  556,  559,  559,  559,
+     562,  562,  562,  564,  564,  566,  566,  568,  568,  570,  570,  572,  572,  574,  574,  576,
+     576,  578,  578,  580,  580,  582,  582,  584,  584,  586,  586,  588,  588,  590,  590,  592,
+     592,  594,  594,
+};
+static const uint32_t schedule_level_2_next_off[] = {
+       1,    1,    3,    3,    5,    5,    7,    7,    9,    9,   11,   11,   13,   13,   15,   15,
+      17,   17,   19,   19,   21,   21,   23,   23,   25,   25,   27,   27,   29,   29,   31,   31,
+      33,   33,   34,   36,   36,   37,   39,   39,   40,   42,   42,   43,   45,   45,   46,   48,
+      48,   49,   51,   51,   52,   54,   54,   55,   57,   57,   58,   60,   60,   61,   63,   63,
+      64,   66,   66,   67,   69,   69,   70,   72,   72,   73,   75,   75,   76,   78,   78,   79,
+      81,   81,   82,   84,   84,   85,   87,   87,   88,   90,   90,   91,   93,   93,   94,   96,
+      96,   97,   99,   99,  100,  102,  102,  103,  105,  105,  106,  108,  108,  109,  111,  111,
+     112,  114,  114,  115,  117,  117,  118,  120,  120,  121,  123,  123,  124,  126,  126,  127,
+     129,  129,  130,  132,  132,  133,  135,  135,  136,  138,  138,  139,  141,  141,  142,  144,
+     144,  145,  147,  147,  148,  150,  150,  151,  153,  153,  154,  156,  156,  157,  159,  159,
+     160,  162,  162,  163,  165,  165,  166,  168,  168,  169,  171,  171,  172,  174,  174,  175,
+     177,  177,  178,  180,  180,  181,  183,  183,  184,  186,  186,  187,  189,  189,  190,  192,
+     192,  193,  195,  195,  196,  198,  198,  199,  201,  201,  202,  204,  204,  205,  207,  207,
+     208,  210,  210,  212,  212,  213,  215,  215,  216,  218,  218,  219,  221,  221,  222,  224,
+     224,  225,  227,  227,  228,  230,  230,  231,  233,  233,  234,  236,  236,  237,  239,  239,
+     240,  242,  242,  243,  245,  245,  246,  248,  248,  249,  251,  251,  252,  254,  254,  255,
+     257,  257,  258,  260,  260,  261,  263,  263,  264,  266,  266,  267,  269,  269,  270,  272,
+     272,  273,  275,  275,  276,  278,  278,  279,  281,  281,  282,  284,  284,  285,  287,  287,
+     289,  289,  291,  291,  292,  294,  294,  295,  297,  297,  298,  300,  300,  301,  303,  303,
+     304,  306,  306,  307,  309,  309,  310,  312,  312,  313,  315,  315,  316,  318,  318,  319,
+     321,  321,  322,  324,  324,  325,  327,  327,  328,  330,  330,  331,  333,  333,  334,  336,
+     336,  337,  339,  339,  340,  342,  342,  343,  345,  345,  346,  348,  348,  349,  351,  351,
+     352,  354,  354,  355,  357,  357,  358,  360,  360,  361,  363,  363,  364,  366,  366,  367,
+     369,  369,  370,  372,  372,  373,  375,  375,  376,  378,  378,  379,  381,  381,  382,  384,
+     384,  385,  387,  387,  388,  390,  390,  391,  393,  393,  394,  396,  396,  397,  399,  399,
+     400,  402,  402,  403,  405,  405,  406,  408,  408,  409,  411,  411,  412,  414,  414,  416,
+     416,  417,  419,  419,  420,  422,  422,  423,  425,  425,  426,  428,  428,  429,  431,  431,
+     432,  434,  434,  435,  437,  437,  438,  440,  440,  441,  443,  443,  444,  446,  446,  447,
+     449,  449,  450,  452,  452,  453,  455,  455,  456,  458,  458,  459,  461,  461,  462,  464,
+     464,  465,  467,  467,  468,  470,  470,  471,  473,  473,  474,  476,  476,  477,  479,  479,
+     480,  482,  482,  483,  485,  485,  486,  488,  488,  489,  491,  491,  492,  494,  494,  495,
+     497,  497,  498,  500,  500,  501,  503,  503,  504,  506,  506,  507,  509,  509,  510,  512,
+     512,  513,  515,  515,  516,  518,  518,  519,  521,  521,  522,  524,  524,  525,  527,  527,
+     528,  530,  530,  531,  533,  533,  534,  536,  536,  537,  539,  539,  540,  542,  542,  543,
+     545,  545,  546,  548,  548,  549,  551,  551,  552,  554,  554,  555,  557,  557,  558,  560,
+     560,  561,  563,  563,  565,  565,  567,  567,  569,  569,  571,  571,  573,  573,  575,  575,
+     577,  577,  579,  579,  581,  581,  583,  583,  585,  585,  587,  587,  589,  589,  591,  591,
+     593,  593,  594,
+};
+static const uint32_t schedule_level_2_region_end[] = {
+       1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15,   16,
+      17,   18,   19,   20,   21,   22,   23,   24,   25,   26,   27,   28,   29,   30,   31,   32,
+      33,   35,   35,   36,   38,   38,   39,   41,   41,   42,   44,   44,   45,   47,   47,   48,
+      50,   50,   51,   53,   53,   54,   56,   56,   57,   59,   59,   60,   62,   62,   63,   65,
+      65,   66,   68,   68,   69,   71,   71,   72,   74,   74,   75,   77,   77,   78,   80,   80,
+      81,   83,   83,   84,   86,   86,   87,   89,   89,   90,   92,   92,   93,   95,   95,   96,
+      98,   98,   99,  101,  101,  102,  104,  104,  105,  107,  107,  108,  110,  110,  111,  113,
+     113,  114,  116,  116,  117,  119,  119,  120,  122,  122,  123,  125,  125,  126,  128,  128,
+     129,  131,  131,  132,  134,  134,  135,  137,  137,  138,  140,  140,  141,  143,  143,  144,
+     146,  146,  147,  149,  149,  150,  152,  152,  153,  155,  155,  156,  158,  158,  159,  161,
+     161,  162,  164,  164,  165,  167,  167,  168,  170,  170,  171,  173,  173,  174,  176,  176,
+     177,  179,  179,  180,  182,  182,  183,  185,  185,  186,  188,  188,  189,  191,  191,  192,
+     194,  194,  195,  197,  197,  198,  200,  200,  201,  203,  203,  204,  206,  206,  207,  209,
+     209,  210,  211,  212,  214,  214,  215,  217,  217,  218,  220,  220,  221,  223,  223,  224,
+     226,  226,  227,  229,  229,  230,  232,  232,  233,  235,  235,  236,  238,  238,  239,  241,
+     241,  242,  244,  244,  245,  247,  247,  248,  250,  250,  251,  253,  253,  254,  256,  256,
+     257,  259,  259,  260,  262,  262,  263,  265,  265,  266,  268,  268,  269,  271,  271,  272,
+     274,  274,  275,  277,  277,  278,  280,  280,  281,  283,  283,  284,  286,  286,  287,  288,
+     289,  290,  291,  293,  293,  294,  296,  296,  297,  299,  299,  300,  302,  302,  303,  305,
+     305,  306,  308,  308,  309,  311,  311,  312,  314,  314,  315,  317,  317,  318,  320,  320,
+     321,  323,  323,  324,  326,  326,  327,  329,  329,  330,  332,  332,  333,  335,  335,  336,
+     338,  338,  339,  341,  341,  342,  344,  344,  345,  347,  347,  348,  350,  350,  351,  353,
+     353,  354,  356,  356,  357,  359,  359,  360,  362,  362,  363,  365,  365,  366,  368,  368,
+     369,  371,  371,  372,  374,  374,  375,  377,  377,  378,  380,  380,  381,  383,  383,  384,
+     386,  386,  387,  389,  389,  390,  392,  392,  393,  395,  395,  396,  398,  398,  399,  401,
+     401,  402,  404,  404,  405,  407,  407,  408,  410,  410,  411,  413,  413,  414,  415,  416,
+     418,  418,  419,  421,  421,  422,  424,  424,  425,  427,  427,  428,  430,  430,  431,  433,
+     433,  434,  436,  436,  437,  439,  439,  440,  442,  442,  443,  445,  445,  446,  448,  448,
+     449,  451,  451,  452,  454,  454,  455,  457,  457,  458,  460,  460,  461,  463,  463,  464,
+     466,  466,  467,  469,  469,  470,  472,  472,  473,  475,  475,  476,  478,  478,  479,  481,
+     481,  482,  484,  484,  485,  487,  487,  488,  490,  490,  491,  493,  493,  494,  496,  496,
+     497,  499,  499,  500,  502,  502,  503,  505,  505,  506,  508,  508,  509,  511,  511,  512,
+     514,  514,  515,  517,  517,  518,  520,  520,  521,  523,  523,  524,  526,  526,  527,  529,
+     529,  530,  532,  532,  533,  535,  535,  536,  538,  538,  539,  541,  541,  542,  544,  544,
+     545,  547,  547,  548,  550,  550,  551,  553,  553,  554,  556,  556,  557,  559,  559,  560,
+     562,  562,  563,  564,  565,  566,  567,  568,  569,  570,  571,  572,  573,  574,  575,  576,
+     577,  578,  579,  580,  581,  582,  583,  584,  585,  586,  587,  588,  589,  590,  591,  592,
+     593,  594,  594,
+};
+static const schedule_t schedule_level_2 = { 1745939100ull, 594, schedule_level_2_entries, schedule_level_2_next_on, schedule_level_2_next_off, schedule_level_2_region_end };
 /* clang-format on */
@@ -0,0 +1,79 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Delta/varint packed schedules (Implementation)
+ */
+
+#include "schedule_packed.h"
+
+void schedule_packed_reader_init(schedule_packed_reader_t* const r, const schedule_packed_t* const packed)
+{
+    r->packed = packed;
+    r->offset = 0;
+    r->index = 0;
+    r->timestamp = 0;
+}
+
+bool schedule_packed_reader_next(schedule_packed_reader_t* const r, schedule_entry_t* const e)
+{
+    const schedule_packed_t* const packed = r->packed;
+    if (r->index >= packed->num_entries)
+        return false;
+
+    uint32_t value = 0;
+    uint32_t shift = 0;
+    uint32_t offset = r->offset;
+    while (1)
+    {
+        if (offset >= packed->size || shift > 28)
+            return false;
+        const uint8_t byte = packed->data[offset++];
+        /* Bits past the 32nd can't be held */
+        if (shift == 28 && (byte & 0x70))
+            return false;
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+        if (!(byte & 0x80))
+            break;
+    }
+
+    /* Timestamps must fit schedule_entry_t::timestamp and strictly increase, lookups rely on the order */
+    const uint64_t timestamp = (uint64_t)r->timestamp + (uint64_t)(value >> 2) * packed->resolution;
+    if (timestamp >= (1ull << 30) || (r->index > 0 && timestamp == r->timestamp))
+        return false;
+
+    r->offset = offset;
+    r->index++;
+    r->timestamp = (uint32_t)timestamp;
+
+    e->timestamp = r->timestamp;
+    e->on = (value >> 1) & 1;
+    e->allow_resume = value & 1;
+    return true;
+}
@@ -0,0 +1,85 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Delta/varint packed schedules
+ *
+ * Every entry is stored as a single unsigned LEB128 varint of `(delta << 2) | (on << 1) | allow_resume`, where delta is
+ * the number of schedule_packed_t::resolution second units since the previous entry (or schedule_packed_t::epoch for
+ * the first entry). Entries are only ever decoded in order, the blob is never expanded into RAM.
+ */
+#pragma once
+
+#include "schedule.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct schedule_packed_t
+{
+    /** Seconds between 1970 and the first entry */
+    uint64_t epoch;
+    /** Seconds per unit of the encoded deltas */
+    uint32_t resolution;
+    uint32_t num_entries;
+    /** Size (in bytes) of schedule_packed_t::data */
+    uint32_t size;
+    const uint8_t* data;
+} schedule_packed_t;
+
+/** Streaming decoder for packed schedules */
+typedef struct
+{
+    const schedule_packed_t* packed;
+    /** Byte offset of the next entry */
+    uint32_t offset;
+    /** Index of the next entry */
+    uint32_t index;
+    /** Timestamp (in seconds since schedule_packed_t::epoch) of the previous entry */
+    uint32_t timestamp;
+} schedule_packed_reader_t;
+
+/**
+ * Initialize a reader at the first entry of a packed schedule
+ *
+ * @param r Reader to initialize
+ * @param packed Packed schedule to read
+ */
+void schedule_packed_reader_init(schedule_packed_reader_t* const r, const schedule_packed_t* const packed);
+
+/**
+ * Decode the next entry of a packed schedule
+ *
+ * @param r Reader to advance
+ * @param e Output entry, schedule_entry_t::timestamp is relative to schedule_packed_t::epoch
+ *
+ * @returns True if an entry was decoded, False at the end of the schedule, or if the data is truncated or holds a
+ * timestamp that does not fit schedule_entry_t::timestamp or does not advance (schedule_packed_reader_t::index then
+ * stays short of schedule_packed_t::num_entries)
+ */
+bool schedule_packed_reader_next(schedule_packed_reader_t* const r, schedule_entry_t* const e);
@@ -0,0 +1,132 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Schedule flash partition (Implementation)
+ */
+
+#include "schedule_partition.h"
+
+#include "crc32.h"
+
+#include <assert.h> /* static_assert() */
+#include <string.h> /* memcpy() */
+
+static_assert(sizeof(schedule_partition_header_t) == 32, "Partition header layout must match make_schedule_partition.py");
+static_assert(sizeof(schedule_partition_entry_t) == 24, "Partition entry layout must match make_schedule_partition.py");
+
+/** Read a schedule descriptor of a slot that passed the header checks of schedule_partition_validate() */
+static bool schedule_partition_get(const uint8_t* const slot, const schedule_partition_header_t* const header, const uint32_t i, schedule_packed_t* const out)
+{
+    schedule_partition_entry_t entry;
+    memcpy(&entry, slot + sizeof(*header) + i * sizeof(entry), sizeof(entry));
+
+    /* The data must lie between the descriptor table and the end of the payload */
+    const uint32_t start = sizeof(*header) + header->num_schedules * sizeof(entry);
+    const uint32_t end = sizeof(*header) + header->payload_size;
+    if (entry.offset < start || entry.offset > end || entry.size > end - entry.offset || entry.resolution == 0)
+        return false;
+
+    out->epoch = entry.epoch;
+    out->resolution = entry.resolution;
+    out->num_entries = entry.num_entries;
+    out->size = entry.size;
+    out->data = slot + entry.offset;
+    return true;
+}
+
+bool schedule_partition_validate(const uint8_t* const slot, const uint32_t slot_size, schedule_partition_header_t* const header_out)
+{
+    schedule_partition_header_t header;
+    if (slot_size < sizeof(header))
+        return false;
+    memcpy(&header, slot, sizeof(header));
+
+    if (header.magic != SCHEDULE_PARTITION_MAGIC || header.version != SCHEDULE_PARTITION_VERSION)
+        return false;
+    if (header.payload_size > slot_size - sizeof(header))
+        return false;
+    if (header.num_schedules > header.payload_size / sizeof(schedule_partition_entry_t))
+        return false;
+
+    if (crc32_update(0, slot + sizeof(header), header.payload_size) != header.payload_crc)
+        return false;
+
+    for (uint32_t i = 0; i < header.num_schedules; i++)
+    {
+        schedule_packed_t packed;
+        if (!schedule_partition_get(slot, &header, i, &packed))
+            return false;
+
+        /* The reader stops early on truncated data, and on timestamps that are out of order or do not fit in 30 bits */
+        schedule_packed_reader_t r;
+        schedule_packed_reader_init(&r, &packed);
+        schedule_entry_t e;
+        while (schedule_packed_reader_next(&r, &e))
+            ;
+        if (r.index != packed.num_entries)
+            return false;
+    }
+
+    if (header_out)
+        *header_out = header;
+    return true;
+}
+
+int schedule_partition_find_active(const uint8_t* const partition, const uint32_t slot_size, const uint32_t num_slots, uint32_t* const sequence)
+{
+    int active = -1;
+    uint32_t active_sequence = 0;
+    for (uint32_t i = 0; i < num_slots; i++)
+    {
+        schedule_partition_header_t header;
+        if (!schedule_partition_validate(partition + i * slot_size, slot_size, &header))
+            continue;
+        if (active == -1 || header.sequence > active_sequence)
+        {
+            active = i;
+            active_sequence = header.sequence;
+        }
+    }
+
+    if (sequence)
+        *sequence = active_sequence;
+    return active;
+}
+
+bool schedule_partition_load(const uint8_t* const slot, const uint32_t slot_size, schedule_packed_t* const out, const uint32_t num_out)
+{
+    schedule_partition_header_t header;
+    if (!schedule_partition_validate(slot, slot_size, &header) || header.num_schedules < num_out)
+        return false;
+
+    for (uint32_t i = 0; i < num_out; i++)
+        schedule_partition_get(slot, &header, i, &out[i]);
+
+    return true;
+}
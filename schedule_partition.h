@@ -0,0 +1,126 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Schedule flash partition
+ *
+ * A reserved region of flash that holds packed schedules (see schedule_packed.h), so that the schedules can be
+ * replaced without rebuilding or reflashing the firmware. Slot images are produced by make_schedule_partition.py
+ *
+ * The partition is split into equally sized slots, the active slot is the valid slot with the highest
+ * schedule_partition_header_t::sequence. A new image is written to an inactive slot with its first page (which holds
+ * the header) programmed last, so switching over to it is atomic.
+ *
+ * Slot layout:
+ * - schedule_partition_header_t
+ * - schedule_partition_header_t::num_schedules x schedule_partition_entry_t
+ * - Packed schedule data
+ *
+ * Everything after the header is covered by schedule_partition_header_t::payload_crc. All fields are little endian.
+ */
+#pragma once
+
+#include "schedule_packed.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** "PLSS" */
+#define SCHEDULE_PARTITION_MAGIC 0x53534C50u
+
+#define SCHEDULE_PARTITION_VERSION 1u
+
+typedef struct
+{
+    /** Must be @ref SCHEDULE_PARTITION_MAGIC */
+    uint32_t magic;
+    /** Must be @ref SCHEDULE_PARTITION_VERSION */
+    uint32_t version;
+    /** Size (in bytes) of everything after the header */
+    uint32_t payload_size;
+    /** CRC-32 of everything after the header */
+    uint32_t payload_crc;
+    uint32_t num_schedules;
+    /** Slot with the highest sequence number wins */
+    uint32_t sequence;
+    uint32_t reserved[2];
+} schedule_partition_header_t;
+
+typedef struct
+{
+    /** Seconds between 1970 and the first entry */
+    uint64_t epoch;
+    /** Seconds per unit of the encoded deltas */
+    uint32_t resolution;
+    uint32_t num_entries;
+    /** Offset (in bytes, relative to the start of the slot) of the packed data */
+    uint32_t offset;
+    /** Size (in bytes) of the packed data */
+    uint32_t size;
+} schedule_partition_entry_t;
+
+/**
+ * Validate a schedule partition slot
+ *
+ * Checks the header, the CRC, that the data of every schedule lies after the descriptor table, and that every schedule
+ * decodes to its number of entries with strictly increasing timestamps below 2^30 (The CRC is computed by whoever made
+ * the image, it only guards against corruption)
+ *
+ * @param slot Start of the slot (eg. an XIP address)
+ * @param slot_size Size (in bytes) of the slot
+ * @param header Output header (May be NULL)
+ *
+ * @returns True if the slot is valid, False otherwise
+ */
+bool schedule_partition_validate(const uint8_t* const slot, const uint32_t slot_size, schedule_partition_header_t* const header);
+
+/**
+ * Find the active slot of a schedule partition
+ *
+ * @param partition Start of the partition (eg. an XIP address)
+ * @param slot_size Size (in bytes) of each slot
+ * @param num_slots Number of slots in the partition
+ * @param sequence Output sequence number of the active slot (May be NULL)
+ *
+ * @returns Index of the active slot, or -1 if no slot is valid
+ */
+int schedule_partition_find_active(const uint8_t* const partition, const uint32_t slot_size, const uint32_t num_slots, uint32_t* const sequence);
+
+/**
+ * Validate a schedule partition slot and point packed schedules at its contents
+ *
+ * No schedule data is copied, schedule_packed_t::data points into the slot
+ *
+ * @param slot Start of the slot (eg. an XIP address)
+ * @param slot_size Size (in bytes) of the slot
+ * @param out Output packed schedules
+ * @param num_out Number of schedules required
+ *
+ * @returns True if the slot is valid and holds at least num_out schedules, False otherwise
+ */
+bool schedule_partition_load(const uint8_t* const slot, const uint32_t slot_size, schedule_packed_t* const out, const uint32_t num_out);
@@ -0,0 +1,162 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Recurrence rule schedules (Implementation)
+ */
+
+#include "schedule_rules.h"
+
+#include "config.h"
+#include "time_64bit.h"
+
+static int64_t floor_div(const int64_t a, const int64_t b)
+{
+    int64_t q = a / b;
+    if ((a % b) != 0 && ((a < 0) != (b < 0)))
+        q--;
+    return q;
+}
+
+/** Convert seconds since 1970-01-01 UTC to seconds since 1970-01-01 in local (wall clock) time */
+static int64_t unix_to_local(const int64_t unix_time)
+{
+    tm_64_bit_t tm = {};
+    gmtime_r_64bit(unix_time, &tm);
+    get_tz_corrected_tm_64_bit(&tm, &tm, TIMEZONE_OFFSET_ST, TIMEZONE_OFFSET_DT);
+    return mktime_64bit(&tm);
+}
+
+/**
+ * Convert seconds since 1970-01-01 in local (wall clock) time to seconds since 1970-01-01 UTC
+ *
+ * Ambiguous times resolve to daylight time, matching the behavior of generate_schedules.py (fold=0)
+ */
+static int64_t local_to_unix(const int64_t local)
+{
+    const int64_t guess_dt = local - TIMEZONE_OFFSET_DT;
+    if (unix_to_local(guess_dt) == local)
+        return guess_dt;
+    return local - TIMEZONE_OFFSET_ST;
+}
+
+static bool day_is_exception(const schedule_rules_t* const rules, const int64_t day)
+{
+    uint32_t lo = 0;
+    uint32_t hi = rules->num_exceptions;
+    while (lo < hi)
+    {
+        const uint32_t mid = lo + (hi - lo) / 2;
+        if (rules->exceptions[mid].last < day)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < rules->num_exceptions && rules->exceptions[lo].first <= day;
+}
+
+/** Get the events of a local day, 1970-01-01 was a Thursday */
+static const schedule_entry_t* day_events(const schedule_rules_t* const rules, const int64_t day, uint16_t* const num_events)
+{
+    const schedule_week_t* const week = day_is_exception(rules, day) ? &rules->exception : &rules->regular;
+    const int64_t day_of_week = ((day + 4) % 7 + 7) % 7;
+    *num_events = week->day_start[day_of_week + 1] - week->day_start[day_of_week];
+    return week->events + week->day_start[day_of_week];
+}
+
+/* The order of events in unix time can only differ from their order in local time by the size of a DST shift */
+#define DST_SLACK (60ll * 60ll)
+
+schedule_current_state_t schedule_rules_get_state(const schedule_rules_t* const rules, const int64_t unix_time)
+{
+    const int64_t DAY = SCHEDULE_RULES_SECONDS_PER_DAY;
+    const int64_t today = floor_div(unix_to_local(unix_time), DAY);
+
+    schedule_current_state_t r = { 0 };
+    r.timestamp_region_next_off = UINT64_MAX;
+    r.timestamp_region_next_on = UINT64_MAX;
+
+    /* Most recent event before unix_time, events of a day happen before local midnight two days later */
+    bool found_past = false;
+    int64_t past_local = 0;
+    for (int64_t day = today + 1; day >= today - SCHEDULE_RULES_MAX_SEARCH_DAYS; day--)
+    {
+        if (found_past && past_local >= (day + 2) * DAY + DST_SLACK)
+            break;
+
+        uint16_t num_events = 0;
+        const schedule_entry_t* const events = day_events(rules, day, &num_events);
+        for (uint16_t i = num_events; i > 0; i--)
+        {
+            const schedule_entry_t* const e = &events[i - 1];
+            const int64_t local = day * DAY + e->timestamp;
+            const int64_t ts = local_to_unix(local);
+            if (ts < unix_time && (!found_past || ts > (int64_t)r.timestamp_region_start))
+            {
+                found_past = true;
+                past_local = local;
+                r.on = e->on;
+                r.allow_resume = e->allow_resume && (r.on ? SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_ON_REGION : SCHEDULE_TRIGGER_REGION_ON_RESET_IF_IN_OFF_REGION);
+                r.timestamp_region_start = ts;
+                r.in_region = unix_time < (int64_t)(ts + SCHEDULE_TRIGGER_REGION_LENGTH);
+            }
+        }
+    }
+
+    /* Next "ON" and "OFF" events, events of a day happen after local midnight of that day */
+    int64_t next_on_local = INT64_MAX;
+    int64_t next_off_local = INT64_MAX;
+    for (int64_t day = today - 1; day <= today + SCHEDULE_RULES_MAX_SEARCH_DAYS; day++)
+    {
+        if (next_on_local != INT64_MAX && next_off_local != INT64_MAX && day * DAY >= next_on_local + DST_SLACK && day * DAY >= next_off_local + DST_SLACK)
+            break;
+
+        uint16_t num_events = 0;
+        const schedule_entry_t* const events = day_events(rules, day, &num_events);
+        for (uint16_t i = 0; i < num_events; i++)
+        {
+            const schedule_entry_t* const e = &events[i];
+            const int64_t local = day * DAY + e->timestamp;
+            const int64_t ts = local_to_unix(local);
+            if (ts < unix_time)
+                continue;
+            if (e->on && (uint64_t)ts < r.timestamp_region_next_on)
+            {
+                r.timestamp_region_next_on = ts;
+                next_on_local = local;
+            }
+            if (!e->on && (uint64_t)ts < r.timestamp_region_next_off)
+            {
+                r.timestamp_region_next_off = ts;
+                next_off_local = local;
+            }
+        }
+    }
+
+    return r;
+}
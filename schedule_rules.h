@@ -0,0 +1,90 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Recurrence rule schedules
+ *
+ * Instead of every event being expanded into a schedule_t, a rule schedule is made of two weekly templates and a set
+ * of exception dates. Regular days use schedule_rules_t::regular, days within any of schedule_rules_t::exceptions use
+ * schedule_rules_t::exception. Rule schedules have no end date.
+ */
+#pragma once
+
+#include "schedule.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Maximum number of days searched in either direction for an event */
+#define SCHEDULE_RULES_MAX_SEARCH_DAYS 400
+
+/** Seconds in a day */
+#define SCHEDULE_RULES_SECONDS_PER_DAY (24ll * 60ll * 60ll)
+
+/**
+ * Weekly template
+ *
+ * schedule_entry_t::timestamp is the number of seconds after local midnight of the day that the event belongs to,
+ * it may exceed a day (eg. 25:00 for 01:00 of the following day) but must be less than two days.
+ */
+typedef struct
+{
+    /** Events of every day of the week, grouped by day (Sunday first) and sorted by time */
+    const schedule_entry_t* events;
+    /** Index into schedule_week_t::events of the first event of each day, day_start[7] is the total number of events */
+    uint16_t day_start[8];
+} schedule_week_t;
+
+/** Inclusive range of days (in local days since 1970-01-01) */
+typedef struct
+{
+    int32_t first;
+    int32_t last;
+} schedule_day_range_t;
+
+typedef struct schedule_rules_t
+{
+    /** Template used on regular days */
+    schedule_week_t regular;
+    /** Template used on days within schedule_rules_t::exceptions */
+    schedule_week_t exception;
+    uint32_t num_exceptions;
+    /** Sorted and non-overlapping exception date ranges */
+    const schedule_day_range_t* exceptions;
+} schedule_rules_t;
+
+/**
+ * Evaluate a rule schedule
+ *
+ * Looks at most @ref SCHEDULE_RULES_MAX_SEARCH_DAYS days in either direction, in practice the search ends within a
+ * week when both templates have at least one event.
+ *
+ * @param rules Rules to evaluate
+ * @param unix_time Time (in seconds since 1970-01-01) to evaluate the schedule at
+ */
+schedule_current_state_t schedule_rules_get_state(const schedule_rules_t* const rules, const int64_t unix_time);
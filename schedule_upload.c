@@ -0,0 +1,482 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Schedule partition upload over TCP (Implementation)
+ */
+
+#include "schedule_upload.h"
+
+#include "config.h"
+#include "crc32.h"
+#include "flash_guard.h"
+#include "schedule_partition.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "hardware/regs/addressmap.h"
+#include "hardware/sync.h"
+#include "lwip/tcp.h"
+#include "pico/cyw43_arch.h"
+#include "pico/flash.h"
+#include "pico/time.h"
+
+#if SCHEDULE_UPLOAD_ENABLE
+#if !SCHEDULE_PARTITION_ENABLE || SCHEDULE_PARTITION_NUM_SLOTS < 2
+#error "SCHEDULE_UPLOAD_ENABLE requires SCHEDULE_PARTITION_ENABLE and at least 2 slots"
+#endif
+
+#define LOG(fmt, ...) printf("Core %u: " fmt, get_core_num(), ##__VA_ARGS__)
+
+/** "PLSU" */
+#define UPLOAD_MAGIC 0x55534C50u
+
+/** Size (in bytes) of the magic and image size sent before the image */
+#define UPLOAD_PREAMBLE_SIZE 8
+
+/** Time (in milliseconds) to wait for core 1 to be paused before a flash operation */
+#define UPLOAD_FLASH_LOCKOUT_TIMEOUT 100
+
+volatile uint32_t schedule_upload_generation = 1;
+volatile uint32_t schedule_upload_generation_applied = 0;
+
+enum upload_state_t
+{
+    UPLOAD_IDLE,
+    UPLOAD_PREAMBLE,
+    UPLOAD_DATA,
+    UPLOAD_COMMIT,
+};
+
+static struct
+{
+    struct tcp_pcb* listen_pcb;
+    struct tcp_pcb* pcb;
+    /** Received data that has not been consumed yet, the TCP window is only reopened once it is */
+    struct pbuf* queue;
+    uint16_t queue_offset;
+
+    enum upload_state_t state;
+    uint64_t timestamp_activity;
+
+    uint8_t preamble[UPLOAD_PREAMBLE_SIZE];
+    uint32_t preamble_len;
+
+    uint32_t slot;
+    uint32_t sequence;
+    /** Size (in bytes) of the image */
+    uint32_t size;
+    /** Image bytes received */
+    uint32_t received;
+    /** Image bytes programmed (or held in first_page), always a multiple of FLASH_PAGE_SIZE */
+    uint32_t programmed;
+    /** Slot bytes erased, always a multiple of FLASH_SECTOR_SIZE */
+    uint32_t erased;
+    uint32_t crc;
+
+    uint8_t page[FLASH_PAGE_SIZE];
+    uint32_t page_len;
+    /** The page holding the header, programmed once everything else is */
+    uint8_t first_page[FLASH_PAGE_SIZE];
+} upload;
+
+struct flash_op_t
+{
+    uint32_t offset;
+    const uint8_t* data;
+};
+
+static void flash_op_erase(void* param) { flash_range_erase(((const struct flash_op_t*)param)->offset, FLASH_SECTOR_SIZE); }
+
+static void flash_op_program(void* param)
+{
+    const struct flash_op_t* op = param;
+    flash_range_program(op->offset, op->data, FLASH_PAGE_SIZE);
+}
+
+static const uint8_t* slot_address(const uint32_t slot) { return (const uint8_t*)(XIP_BASE + SCHEDULE_PARTITION_OFFSET + slot * SCHEDULE_PARTITION_SLOT_SIZE); }
+
+static void upload_close()
+{
+    if (upload.queue)
+        pbuf_free(upload.queue);
+    upload.queue = NULL;
+    upload.queue_offset = 0;
+
+    if (upload.pcb)
+    {
+        tcp_arg(upload.pcb, NULL);
+        tcp_recv(upload.pcb, NULL);
+        tcp_err(upload.pcb, NULL);
+        if (tcp_close(upload.pcb) != ERR_OK)
+            tcp_abort(upload.pcb);
+    }
+    upload.pcb = NULL;
+    upload.state = UPLOAD_IDLE;
+}
+
+static void upload_reply_and_close(const char* fmt, ...) __attribute__((format(__printf__, 1, 2)));
+static void upload_reply_and_close(const char* fmt, ...)
+{
+    char buf[64];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (len > (int)sizeof(buf) - 1)
+        len = sizeof(buf) - 1;
+
+    LOG("Schedule upload: %s", buf);
+    if (upload.pcb && len > 0)
+    {
+        tcp_write(upload.pcb, buf, len, TCP_WRITE_FLAG_COPY);
+        tcp_output(upload.pcb);
+    }
+    upload_close();
+}
+
+static err_t upload_recv_cb(void* arg, struct tcp_pcb* pcb, struct pbuf* p, err_t err)
+{
+    (void)arg;
+    (void)err;
+
+    /* Remote closed the connection, which is only fine once the whole image has been received */
+    if (!p)
+    {
+        const uint32_t queued = upload.queue ? upload.queue->tot_len - upload.queue_offset : 0;
+        if (upload.state == UPLOAD_PREAMBLE && upload.preamble_len + queued < UPLOAD_PREAMBLE_SIZE)
+            upload_reply_and_close("ERR connection closed in the preamble\n");
+        else if (upload.state == UPLOAD_PREAMBLE || (upload.state == UPLOAD_DATA && upload.received + queued < upload.size))
+            upload_reply_and_close("ERR connection closed after %lu of %lu bytes\n", (unsigned long)upload.received, (unsigned long)upload.size);
+        return ERR_OK;
+    }
+
+    if (pcb != upload.pcb || upload.state == UPLOAD_IDLE)
+    {
+        tcp_recved(pcb, p->tot_len);
+        pbuf_free(p);
+        return ERR_OK;
+    }
+
+    if (upload.queue)
+        pbuf_cat(upload.queue, p);
+    else
+        upload.queue = p;
+    upload.timestamp_activity = time_us_64();
+    return ERR_OK;
+}
+
+static void upload_err_cb(void* arg, err_t err)
+{
+    (void)arg;
+    LOG("Schedule upload: Connection error %d\n", err);
+    /* The pcb has already been freed */
+    upload.pcb = NULL;
+    upload_close();
+}
+
+static err_t upload_accept_cb(void* arg, struct tcp_pcb* pcb, err_t err)
+{
+    (void)arg;
+    if (err != ERR_OK || !pcb)
+        return ERR_VAL;
+
+    if (upload.pcb)
+    {
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+
+    LOG("Schedule upload: Connection from %s\n", ipaddr_ntoa(&pcb->remote_ip));
+    upload.pcb = pcb;
+    upload.state = UPLOAD_PREAMBLE;
+    upload.timestamp_activity = time_us_64();
+    upload.preamble_len = 0;
+    upload.size = 0;
+    upload.received = 0;
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, upload_recv_cb);
+    tcp_err(pcb, upload_err_cb);
+    return ERR_OK;
+}
+
+void schedule_upload_init()
+{
+    cyw43_arch_lwip_begin();
+    struct tcp_pcb* pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+    if (!pcb || tcp_bind(pcb, IP_ANY_TYPE, SCHEDULE_UPLOAD_PORT) != ERR_OK)
+    {
+        LOG("Schedule upload: Failed to bind port %d\n", SCHEDULE_UPLOAD_PORT);
+        if (pcb)
+            tcp_close(pcb);
+        cyw43_arch_lwip_end();
+        return;
+    }
+    upload.listen_pcb = tcp_listen_with_backlog(pcb, 1);
+    if (upload.listen_pcb)
+        tcp_accept(upload.listen_pcb, upload_accept_cb);
+    else
+        tcp_close(pcb);
+    cyw43_arch_lwip_end();
+
+    LOG("Schedule upload: Listening on port %d\n", SCHEDULE_UPLOAD_PORT);
+}
+
+/** Copy up to len received bytes to dst, returns the number of bytes copied */
+static uint32_t upload_read(void* const dst, const uint32_t len)
+{
+    if (!upload.queue || !len)
+        return 0;
+
+    const uint16_t avail = upload.queue->tot_len - upload.queue_offset;
+    const uint16_t n = pbuf_copy_partial(upload.queue, dst, len < avail ? len : avail, upload.queue_offset);
+    upload.queue_offset += n;
+
+    if (upload.queue_offset == upload.queue->tot_len)
+    {
+        tcp_recved(upload.pcb, upload.queue->tot_len);
+        pbuf_free(upload.queue);
+        upload.queue = NULL;
+        upload.queue_offset = 0;
+    }
+    return n;
+}
+
+/**
+ * Program a page of the slot, erasing its sector first if needed
+ *
+ * At most one flash operation is done per call
+ *
+ * @returns 1 once the page has been programmed, 0 if it should be called again, -1 on error
+ */
+static int upload_program_page(const uint32_t offset, const uint8_t* const data)
+{
+    if (!flash_guard_allowed())
+        return 0;
+
+    const uint32_t slot_offset = SCHEDULE_PARTITION_OFFSET + upload.slot * SCHEDULE_PARTITION_SLOT_SIZE;
+    upload.timestamp_activity = time_us_64();
+
+    if (offset >= upload.erased)
+    {
+        struct flash_op_t op = { slot_offset + upload.erased, NULL };
+        if (flash_safe_execute(flash_op_erase, &op, UPLOAD_FLASH_LOCKOUT_TIMEOUT) != PICO_OK)
+            return -1;
+        upload.erased += FLASH_SECTOR_SIZE;
+        return 0;
+    }
+
+    struct flash_op_t op = { slot_offset + offset, data };
+    if (flash_safe_execute(flash_op_program, &op, UPLOAD_FLASH_LOCKOUT_TIMEOUT) != PICO_OK)
+        return -1;
+    return 1;
+}
+
+static void upload_poll_preamble()
+{
+    upload.preamble_len += upload_read(upload.preamble + upload.preamble_len, UPLOAD_PREAMBLE_SIZE - upload.preamble_len);
+    if (upload.preamble_len < UPLOAD_PREAMBLE_SIZE)
+        return;
+
+    uint32_t magic;
+    memcpy(&magic, upload.preamble, sizeof(magic));
+    memcpy(&upload.size, upload.preamble + sizeof(magic), sizeof(upload.size));
+
+    if (magic != UPLOAD_MAGIC)
+    {
+        upload_reply_and_close("ERR bad magic\n");
+        return;
+    }
+    if (upload.size < sizeof(schedule_partition_header_t) || upload.size > SCHEDULE_PARTITION_SLOT_SIZE)
+    {
+        upload_reply_and_close("ERR image size %lu must be between %u and %u\n", (unsigned long)upload.size,
+            (unsigned)sizeof(schedule_partition_header_t), (unsigned)SCHEDULE_PARTITION_SLOT_SIZE);
+        return;
+    }
+    if (schedule_upload_generation != schedule_upload_generation_applied)
+    {
+        upload_reply_and_close("ERR busy\n");
+        return;
+    }
+
+    /* Definition in the pico-sdk linker script */
+    extern char __flash_binary_end;
+    if ((uintptr_t)&__flash_binary_end > (uintptr_t)slot_address(0))
+    {
+        upload_reply_and_close("ERR partition overlaps the firmware\n");
+        return;
+    }
+
+    /* Core 1 is reading from the active slot (if any), so write to the one after it */
+    uint32_t sequence;
+    const int active = schedule_partition_find_active(slot_address(0), SCHEDULE_PARTITION_SLOT_SIZE, SCHEDULE_PARTITION_NUM_SLOTS, &sequence);
+    upload.slot = (active + 1) % SCHEDULE_PARTITION_NUM_SLOTS;
+    upload.sequence = active < 0 ? 1 : sequence + 1;
+
+    upload.received = 0;
+    upload.programmed = 0;
+    upload.erased = 0;
+    upload.crc = 0;
+    upload.page_len = 0;
+    upload.state = UPLOAD_DATA;
+    LOG("Schedule upload: Receiving %lu bytes into slot %lu (sequence %lu)\n", (unsigned long)upload.size, (unsigned long)upload.slot,
+        (unsigned long)upload.sequence);
+}
+
+static void upload_poll_data()
+{
+    /* Flush the page buffer once it is full, or holds the end of the image */
+    if (upload.page_len == FLASH_PAGE_SIZE || (upload.page_len && upload.received == upload.size))
+    {
+        memset(upload.page + upload.page_len, 0xFF, FLASH_PAGE_SIZE - upload.page_len);
+        if (upload.programmed == 0)
+            memcpy(upload.first_page, upload.page, FLASH_PAGE_SIZE);
+        else
+        {
+            const int r = upload_program_page(upload.programmed, upload.page);
+            if (r < 0)
+            {
+                upload_reply_and_close("ERR flash program failed\n");
+                return;
+            }
+            if (r == 0)
+                return;
+        }
+        upload.programmed += FLASH_PAGE_SIZE;
+        upload.page_len = 0;
+    }
+
+    if (upload.received == upload.size)
+    {
+        upload.state = UPLOAD_COMMIT;
+        return;
+    }
+
+    const uint32_t want = FLASH_PAGE_SIZE - upload.page_len;
+    const uint32_t remaining = upload.size - upload.received;
+    const uint32_t n = upload_read(upload.page + upload.page_len, want < remaining ? want : remaining);
+    if (!n)
+        return;
+
+    /* The CRC covers everything after the header */
+    const uint32_t hdr = sizeof(schedule_partition_header_t);
+    if (upload.received + n > hdr)
+    {
+        const uint32_t skip = upload.received < hdr ? hdr - upload.received : 0;
+        upload.crc = crc32_update(upload.crc, upload.page + upload.page_len + skip, n - skip);
+    }
+    upload.page_len += n;
+    upload.received += n;
+
+    /* Reject bad images before touching flash */
+    if (upload.programmed == 0 && upload.received >= hdr && upload.received - n < hdr)
+    {
+        schedule_partition_header_t header;
+        memcpy(&header, upload.page, sizeof(header));
+        if (header.magic != SCHEDULE_PARTITION_MAGIC || header.version != SCHEDULE_PARTITION_VERSION)
+        {
+            upload_reply_and_close("ERR not a schedule partition image\n");
+            return;
+        }
+        if (header.payload_size != upload.size - hdr)
+        {
+            upload_reply_and_close("ERR payload size does not match image size\n");
+            return;
+        }
+    }
+}
+
+static void upload_poll_commit()
+{
+    schedule_partition_header_t header;
+    memcpy(&header, upload.first_page, sizeof(header));
+    if (header.payload_crc != upload.crc)
+    {
+        upload_reply_and_close("ERR CRC mismatch (expected %08lx, got %08lx)\n", (unsigned long)header.payload_crc, (unsigned long)upload.crc);
+        return;
+    }
+
+    header.sequence = upload.sequence;
+    memcpy(upload.first_page, &header, sizeof(header));
+
+    /* Programming the header is what makes the slot valid, so this is the switch-over */
+    const int r = upload_program_page(0, upload.first_page);
+    if (r < 0)
+    {
+        upload_reply_and_close("ERR flash program failed\n");
+        return;
+    }
+    if (r == 0)
+        return;
+
+    if (!schedule_partition_validate(slot_address(upload.slot), SCHEDULE_PARTITION_SLOT_SIZE, NULL))
+    {
+        upload_reply_and_close("ERR slot %lu failed validation after programming\n", (unsigned long)upload.slot);
+        return;
+    }
+
+    schedule_upload_generation++;
+    /* Wake core 1 if it is sleeping (see CORE1_TICKLESS) */
+    __sev();
+    upload_reply_and_close("OK %lu %lu\n", (unsigned long)upload.slot, (unsigned long)upload.sequence);
+}
+
+void schedule_upload_poll()
+{
+    if (upload.state == UPLOAD_IDLE)
+        return;
+
+    cyw43_arch_lwip_begin();
+    if (time_us_64() - upload.timestamp_activity > SCHEDULE_UPLOAD_TIMEOUT)
+        upload_reply_and_close("ERR timeout\n");
+
+    /* Consume as much as possible, but stop after a flash operation so the network keeps being serviced */
+    for (int i = 0; i < 64 && upload.state != UPLOAD_IDLE; i++)
+    {
+        const uint64_t activity = upload.timestamp_activity;
+        const uint32_t received = upload.received + upload.preamble_len + upload.programmed;
+        const enum upload_state_t state = upload.state;
+
+        if (state == UPLOAD_PREAMBLE)
+            upload_poll_preamble();
+        else if (state == UPLOAD_DATA)
+            upload_poll_data();
+        else if (state == UPLOAD_COMMIT)
+            upload_poll_commit();
+
+        const bool flash_op = upload.timestamp_activity != activity;
+        const bool progress = upload.state != state || upload.received + upload.preamble_len + upload.programmed != received;
+        if (flash_op || !progress)
+            break;
+    }
+    cyw43_arch_lwip_end();
+}
+#endif
@@ -0,0 +1,79 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Schedule partition upload over TCP
+ *
+ * Runs on core 0 next to the rest of the network stack. A client (see upload_schedule.py) connects to
+ * @ref SCHEDULE_UPLOAD_PORT and sends:
+ * - The magic "PLSU"
+ * - The size (in bytes) of the image as a little endian uint32_t
+ * - A slot image produced by make_schedule_partition.py
+ *
+ * The image is streamed into an inactive slot of the schedule partition (see schedule_partition.h) as it arrives, with
+ * the page holding the header programmed last. The server replies with "OK <slot> <sequence>\n" or "ERR <reason>\n"
+ * and closes the connection.
+ *
+ * Core 1 keeps running off the old slot until it picks up @ref schedule_upload_generation. Flash is only erased or
+ * programmed while no core 1 event is due within @ref FLASH_GUARD_TIME (see flash_guard.h), because core 1 is paused for
+ * the duration of each operation.
+ *
+ * There is no authentication, so this is only built with -DSCHEDULE_UPLOAD=ON (see CMakeLists.txt).
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Incremented by core 0 every time a new slot becomes active
+ *
+ * Starts at 1 so that uploads are refused until core 1 has loaded its schedules for the first time
+ */
+extern volatile uint32_t schedule_upload_generation;
+
+/**
+ * Value of @ref schedule_upload_generation that core 1 last loaded its schedules at
+ *
+ * Uploads are refused while this differs from @ref schedule_upload_generation, as core 1 may still be reading the slot
+ * that would be overwritten
+ */
+extern volatile uint32_t schedule_upload_generation_applied;
+
+/**
+ * Start listening for uploads
+ *
+ * Must be called on core 0 after the network is up
+ */
+void schedule_upload_init();
+
+/**
+ * Process received data and perform (at most) one flash operation
+ *
+ * Must be called regularly from the core 0 loop
+ */
+void schedule_upload_poll();
@@ -27,30 +27,27 @@
  * DEALINGS IN THE SOFTWARE.
  * @endparblock
  *
- * @brief Schedule struct definitions and the schedules themselves
+ * @brief The schedules themselves
  */
 #pragma once
 
-#include <stdbool.h>
-#include <stdint.h>
+#include "schedule.h"
+#include "schedule_packed.h"
+#include "schedule_rules.h"
 
-typedef struct
-{
-    /** Seconds since schedule_t::epoch */
-    uint32_t timestamp : 30;
-    /** Schedule state */
-    bool on : 1;
-    /** Allow actuators to resume state from reboot */
-    bool allow_resume : 1;
-} schedule_entry_t;
-
-typedef struct
-{
-    /** Seconds between 1970 and the first entry */
-    uint64_t epoch;
-    uint32_t num_entries;
-    schedule_entry_t entries[];
-} schedule_t;
+#include "config.h"
 
+#if SCHEDULE_SOURCE == SCHEDULE_SOURCE_TABLES
 #include "schedule_level_1.h"
 #include "schedule_level_2.h"
+#endif
+
+#if SCHEDULE_SOURCE == SCHEDULE_SOURCE_RULES
+#include "schedule_level_1_rules.h"
+#include "schedule_level_2_rules.h"
+#endif
+
+#if SCHEDULE_SOURCE == SCHEDULE_SOURCE_PACKED || SCHEDULE_PACKED_DECODE_BENCHMARK
+#include "schedule_level_1_packed.h"
+#include "schedule_level_2_packed.h"
+#endif
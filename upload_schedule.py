@@ -0,0 +1,77 @@
+#!/bin/python3
+# SPDX-License-Identifier: MIT
+#
+# SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+# Sends a schedule partition slot image (see schedule_upload.h) to a running pico-light-switch built with
+# -DSCHEDULE_UPLOAD=ON
+#
+# Without an image, one is built from the schedules in generate_schedules.py
+import socket
+import struct
+import sys
+
+UPLOAD_MAGIC = b"PLSU"
+DEFAULT_PORT = 4242
+
+
+def upload(host: str, port: int, image: bytes, timeout: float) -> str:
+    """ Sends image and returns the reply of the device """
+    with socket.create_connection((host, port), timeout=timeout) as sock:
+        sock.sendall(UPLOAD_MAGIC + struct.pack("<I", len(image)) + image)
+        reply = b""
+        while not reply.endswith(b"\n"):
+            chunk = sock.recv(256)
+            if not chunk:
+                break
+            reply += chunk
+    return reply.decode(errors="replace").strip()
+
+
+if __name__ == "__main__":
+    import argparse
+    parser = argparse.ArgumentParser(description="Upload a schedule partition slot image to a pico-light-switch")
+    parser.add_argument("host", help="Address of the pico-light-switch")
+    parser.add_argument("image", nargs="?", default=None, help="Image built by make_schedule_partition.py (default: build one from generate_schedules.py)")
+    parser.add_argument("--port", default=DEFAULT_PORT, help="Port, must match SCHEDULE_UPLOAD_PORT (default %d)" % DEFAULT_PORT, type=int)
+    parser.add_argument("--timeout",
+                        default=60.0,
+                        metavar="SECONDS",
+                        help="Time to wait for the device (default 60s, flash writes are deferred around actuator movement)",
+                        type=float)
+    args = parser.parse_args()
+
+    if args.image is not None:
+        with open(args.image, "rb") as fd:
+            image = fd.read()
+    else:
+        import make_schedule_partition
+        g = make_schedule_partition.generate_schedules
+        image = make_schedule_partition.build_partition([
+            g.generate_schedule(g.time_on_level_1, g.time_off_soft_level_1, g.time_off_level_1),
+            g.generate_schedule(g.time_on_level_2, g.time_off_soft_level_2, g.time_off_level_2),
+        ])
+
+    print(f"Uploading {len(image)} bytes to {args.host}:{args.port}")
+    reply = upload(args.host, args.port, image, args.timeout)
+    print(reply)
+    if not reply.startswith("OK"):
+        sys.exit(1)
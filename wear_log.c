@@ -0,0 +1,284 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Persistent actuator usage counters (Implementation)
+ */
+
+#include "wear_log.h"
+
+#include "config.h"
+#include "crc32.h"
+#include "flash_guard.h"
+
+#include <assert.h> /* static_assert() */
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "hardware/regs/addressmap.h"
+#include "hardware/sync.h"
+#include "pico/flash.h"
+#include "pico/time.h"
+
+#define LOG(fmt, ...) printf("Core %u: " fmt, get_core_num(), ##__VA_ARGS__)
+
+/** Time (in milliseconds) to wait for core 1 to be paused before a flash operation */
+#define WEAR_LOG_FLASH_LOCKOUT_TIMEOUT 100
+
+#define WEAR_LOG_NUM_PAGES (WEAR_LOG_SIZE / FLASH_PAGE_SIZE)
+#define WEAR_LOG_PAGES_PER_SECTOR (FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE)
+
+/** "PLSR" */
+#define WEAR_LOG_RETAINED_MAGIC 0x52534C50u
+
+static_assert(sizeof(wear_log_record_t) <= FLASH_PAGE_SIZE, "A wear log record must fit in a flash page");
+static_assert(WEAR_LOG_SIZE % FLASH_SECTOR_SIZE == 0 && WEAR_LOG_SIZE >= 2 * FLASH_SECTOR_SIZE,
+    "The wear log must be whole sectors, and at least 2 so that the newest record is never erased");
+static_assert(WEAR_LOG_MAX_ACTUATORS <= 32, "Retained in_cycle mask is 32 bits");
+
+static struct
+{
+    bool enabled;
+    size_t num_actuators;
+    /** Totals at boot, the usage since actuator_init() is added to these */
+    struct wear_counters_t base[WEAR_LOG_MAX_ACTUATORS];
+    struct wear_counters_t totals[WEAR_LOG_MAX_ACTUATORS];
+    /** Totals of the last record queued */
+    struct wear_counters_t committed[WEAR_LOG_MAX_ACTUATORS];
+    uint64_t timestamp_commit;
+    uint32_t sequence;
+
+    /** Page the next record is programmed to (Owned by core 0 after wear_log_init()) */
+    uint32_t page;
+    /** Record queued for core 0, padded with 0xFF, core 1 only writes it while pending is false */
+    uint8_t buf[FLASH_PAGE_SIZE];
+    volatile bool pending;
+    struct wear_log_stats_t stats;
+} wear_log;
+
+/** Totals kept across watchdog reboots (RAM keeps its contents, a power cycle fails the CRC) */
+struct wear_log_retained_t
+{
+    uint32_t magic;
+    uint32_t num_actuators;
+    /** Bit i is set if actuator i was in a cycle */
+    uint32_t in_cycle;
+    struct wear_counters_t totals[WEAR_LOG_MAX_ACTUATORS];
+    uint32_t crc;
+};
+static struct wear_log_retained_t __uninitialized_ram(wear_log_retained);
+
+static uint32_t wear_log_retained_crc() { return crc32_update(0, &wear_log_retained, offsetof(struct wear_log_retained_t, crc)); }
+
+static void wear_log_retained_save(const uint32_t in_cycle)
+{
+    wear_log_retained.magic = WEAR_LOG_RETAINED_MAGIC;
+    wear_log_retained.num_actuators = wear_log.num_actuators;
+    wear_log_retained.in_cycle = in_cycle;
+    memcpy(wear_log_retained.totals, wear_log.totals, sizeof(wear_log.totals));
+    wear_log_retained.crc = wear_log_retained_crc();
+}
+
+static const uint8_t* wear_log_page_address(const uint32_t page) { return (const uint8_t*)(XIP_BASE + WEAR_LOG_OFFSET + page * FLASH_PAGE_SIZE); }
+
+/**
+ * Find the newest valid record of the log
+ *
+ * @returns Page of the record, or -1 if there is none
+ */
+static int wear_log_find_newest(wear_log_record_t* const out)
+{
+    int newest = -1;
+    for (uint32_t i = 0; i < WEAR_LOG_NUM_PAGES; i++)
+    {
+        wear_log_record_t r;
+        memcpy(&r, wear_log_page_address(i), sizeof(r));
+        if (r.magic != WEAR_LOG_MAGIC || r.num_actuators > WEAR_LOG_MAX_ACTUATORS)
+            continue;
+        if (crc32_update(0, &r, offsetof(wear_log_record_t, crc)) != r.crc)
+            continue;
+        if (newest == -1 || (int32_t)(r.sequence - out->sequence) > 0)
+        {
+            newest = i;
+            *out = r;
+        }
+    }
+    return newest;
+}
+
+void wear_log_init(const size_t num_actuators)
+{
+    memset(&wear_log, 0, sizeof(wear_log));
+    wear_log.num_actuators = num_actuators < WEAR_LOG_MAX_ACTUATORS ? num_actuators : WEAR_LOG_MAX_ACTUATORS;
+
+    extern char __flash_binary_end;
+    wear_log.enabled = (uintptr_t)&__flash_binary_end <= (uintptr_t)wear_log_page_address(0);
+    if (!wear_log.enabled)
+        LOG("Wear log @ %p overlaps the firmware (ends @ %p), not using it\n", wear_log_page_address(0), &__flash_binary_end);
+
+    wear_log_record_t r;
+    const int newest = wear_log.enabled ? wear_log_find_newest(&r) : -1;
+    if (newest >= 0)
+    {
+        wear_log.page = (newest + 1) % WEAR_LOG_NUM_PAGES;
+        wear_log.sequence = r.sequence;
+        memcpy(wear_log.committed, r.counters, sizeof(wear_log.committed));
+    }
+
+    if (wear_log_retained.magic == WEAR_LOG_RETAINED_MAGIC && wear_log_retained.crc == wear_log_retained_crc()
+        && wear_log_retained.num_actuators == wear_log.num_actuators)
+    {
+        LOG("Wear log: Using retained counters\n");
+        memcpy(wear_log.base, wear_log_retained.totals, sizeof(wear_log.base));
+        for (size_t i = 0; i < wear_log.num_actuators; i++)
+        {
+            if (!(wear_log_retained.in_cycle & (1u << i)))
+                continue;
+            LOG("Wear log: Actuator %u was reset during a cycle\n", (unsigned)i);
+            wear_log.base[i].aborted++;
+        }
+    }
+    else if (newest >= 0)
+    {
+        LOG("Wear log: Using record %u from page %d\n", r.sequence, newest);
+        memcpy(wear_log.base, r.counters, sizeof(wear_log.base));
+    }
+    else
+        LOG("Wear log: No counters found, starting from 0\n");
+
+    memcpy(wear_log.totals, wear_log.base, sizeof(wear_log.totals));
+    wear_log_retained_save(0);
+}
+
+void wear_log_update(const struct actuator_t* const actuators)
+{
+    uint32_t in_cycle = 0;
+    for (size_t i = 0; i < wear_log.num_actuators; i++)
+    {
+        struct actuator_usage_t u;
+        actuator_get_usage(&actuators[i], &u);
+        wear_log.totals[i].cycles = wear_log.base[i].cycles + u.cycles;
+        wear_log.totals[i].extend_us = wear_log.base[i].extend_us + u.extend_us;
+        wear_log.totals[i].retract_us = wear_log.base[i].retract_us + u.retract_us;
+        if (actuator_in_cycle(&actuators[i]))
+            in_cycle |= 1u << i;
+    }
+    wear_log_retained_save(in_cycle);
+
+    /* Records are only committed between cycles, so the log never holds a half done one */
+    if (!wear_log.enabled || wear_log.pending || in_cycle || time_us_64() - wear_log.timestamp_commit < WEAR_LOG_COMMIT_INTERVAL)
+        return;
+    wear_log.timestamp_commit = time_us_64();
+    if (!memcmp(wear_log.committed, wear_log.totals, sizeof(wear_log.totals)))
+        return;
+
+    wear_log_record_t r = {};
+    r.magic = WEAR_LOG_MAGIC;
+    r.sequence = ++wear_log.sequence;
+    r.num_actuators = wear_log.num_actuators;
+    memcpy(r.counters, wear_log.totals, sizeof(r.counters));
+    r.crc = crc32_update(0, &r, offsetof(wear_log_record_t, crc));
+
+    memset(wear_log.buf, 0xFF, sizeof(wear_log.buf));
+    memcpy(wear_log.buf, &r, sizeof(r));
+    memcpy(wear_log.committed, wear_log.totals, sizeof(wear_log.committed));
+    /* The record must be visible to core 0 before the flag is */
+    __dmb();
+    wear_log.pending = true;
+}
+
+void wear_log_get(const size_t i, struct wear_counters_t* const out) { *out = wear_log.totals[i]; }
+
+void wear_log_get_stats(struct wear_log_stats_t* const out) { *out = wear_log.stats; }
+
+struct flash_op_t
+{
+    uint32_t offset;
+    const uint8_t* data;
+};
+
+static void flash_op_erase(void* param) { flash_range_erase(((const struct flash_op_t*)param)->offset, FLASH_SECTOR_SIZE); }
+
+static void flash_op_program(void* param)
+{
+    const struct flash_op_t* op = param;
+    flash_range_program(op->offset, op->data, FLASH_PAGE_SIZE);
+}
+
+static bool wear_log_page_blank(const uint32_t page)
+{
+    const uint8_t* const p = wear_log_page_address(page);
+    for (size_t i = 0; i < FLASH_PAGE_SIZE; i++)
+        if (p[i] != 0xFF)
+            return false;
+    return true;
+}
+
+/** Run a flash operation with core 1 paused, and measure how long it was paused for */
+static bool wear_log_flash_execute(void (*func)(void*), struct flash_op_t* const op)
+{
+    const uint64_t start = time_us_64();
+    if (flash_safe_execute(func, op, WEAR_LOG_FLASH_LOCKOUT_TIMEOUT) != PICO_OK)
+    {
+        wear_log.stats.failures++;
+        return false;
+    }
+    const uint64_t stall = time_us_64() - start;
+    if (stall > wear_log.stats.max_stall_us)
+        wear_log.stats.max_stall_us = stall > UINT32_MAX ? UINT32_MAX : (uint32_t)stall;
+    return true;
+}
+
+void wear_log_poll()
+{
+    if (!wear_log.pending || !flash_guard_allowed())
+        return;
+    __dmb();
+
+    struct flash_op_t op = { WEAR_LOG_OFFSET + wear_log.page * FLASH_PAGE_SIZE, wear_log.buf };
+    if (!wear_log_page_blank(wear_log.page))
+    {
+        /* Moving on to a sector that still holds old records, it never holds the newest one */
+        if (wear_log.page % WEAR_LOG_PAGES_PER_SECTOR == 0)
+        {
+            if (wear_log_flash_execute(flash_op_erase, &op))
+                wear_log.stats.erases++;
+            return;
+        }
+        /* A page half programmed when power was lost, skip it */
+        wear_log.page = (wear_log.page + 1) % WEAR_LOG_NUM_PAGES;
+        return;
+    }
+
+    if (!wear_log_flash_execute(flash_op_program, &op))
+        return;
+    wear_log.stats.commits++;
+    wear_log.page = (wear_log.page + 1) % WEAR_LOG_NUM_PAGES;
+    wear_log.pending = false;
+}
@@ -0,0 +1,126 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Persistent actuator usage counters
+ *
+ * Keeps per-actuator wear counters (cycles, aborted cycles, energized extend/retract time) that survive reboots, so
+ * that actuators and relays can be replaced on actual usage instead of on a fixed schedule.
+ *
+ * Core 1 keeps the running totals in RAM that is not cleared on reset (guarded by a CRC), which carries them across
+ * watchdog reboots such as @ref AUTOMATIC_REBOOT_INTERVAL. Every @ref WEAR_LOG_COMMIT_INTERVAL, while every actuator is
+ * idle, it hands a record to core 0, which appends it to a log in flash that survives power loss.
+ *
+ * The log is a ring of one record per flash page. Records are appended to the page after the newest one, and the next
+ * sector is erased only once the current one is full, so every sector is erased equally often. The newest valid record
+ * (highest wear_log_record_t::sequence) is loaded on boot.
+ *
+ * Core 1 is paused for the duration of each flash operation, so core 0 performs at most one page program or sector
+ * erase per wear_log_poll(), and only while no core 1 event is due within @ref FLASH_GUARD_TIME (see
+ * flash_guard.h).
+ *
+ * A cycle counts as aborted if its actuator was still moving when the board reset. This can only be detected across
+ * reboots that keep RAM, a cycle cut short by a power loss goes unnoticed.
+ */
+#pragma once
+
+#include "actuator.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** "PLSW" */
+#define WEAR_LOG_MAGIC 0x57534C50u
+
+/** Number of actuators a record has room for */
+#define WEAR_LOG_MAX_ACTUATORS ACTUATOR_MAX_CPU
+
+struct wear_counters_t
+{
+    uint64_t extend_us; ///< Time (in microseconds) the extend output was energized
+    uint64_t retract_us; ///< Time (in microseconds) the retract output was energized
+    uint32_t cycles; ///< Number of extend-retract cycles triggered
+    uint32_t aborted; ///< Number of cycles cut short by a reset
+};
+
+typedef struct
+{
+    /** Must be @ref WEAR_LOG_MAGIC */
+    uint32_t magic;
+    /** The record with the highest sequence number (in serial number arithmetic) is the newest */
+    uint32_t sequence;
+    uint32_t num_actuators;
+    uint32_t reserved;
+    struct wear_counters_t counters[WEAR_LOG_MAX_ACTUATORS];
+    /** CRC-32 of everything before this field */
+    uint32_t crc;
+} wear_log_record_t;
+
+/** Counters of the flash side of the log */
+struct wear_log_stats_t
+{
+    uint32_t commits; ///< Records programmed since boot
+    uint32_t erases; ///< Sectors erased since boot
+    uint32_t failures; ///< Flash operations that could not pause core 1 in time (They are retried)
+    uint32_t max_stall_us; ///< Longest flash operation (in microseconds), ie. the longest that core 1 was paused for
+};
+
+/**
+ * Load the counters from retained RAM or the newest flash record
+ *
+ * Must be called on core 1 before actuator_init()
+ *
+ * @param num_actuators Number of actuators (At most @ref WEAR_LOG_MAX_ACTUATORS)
+ */
+void wear_log_init(const size_t num_actuators);
+
+/**
+ * Update the totals from the actuator usage, and queue a record for core 0 when a commit is due
+ *
+ * Must be called regularly from the core 1 loop
+ *
+ * @param actuators Actuators passed to wear_log_init() (Usage is counted since their actuator_init())
+ */
+void wear_log_update(const struct actuator_t* const actuators);
+
+/**
+ * Get the totals of an actuator (As of the last wear_log_update())
+ */
+void wear_log_get(const size_t i, struct wear_counters_t* const out);
+
+/**
+ * Get the counters of the flash side of the log
+ */
+void wear_log_get_stats(struct wear_log_stats_t* const out);
+
+/**
+ * Program a queued record, erasing the next sector first if needed
+ *
+ * Performs at most one flash operation, must be called regularly from the core 0 loop
+ */
+void wear_log_poll();
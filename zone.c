@@ -0,0 +1,172 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Zones: a schedule bound to a select input and a pair of actuators (Implementation)
+ */
+
+#include "zone.h"
+
+#include "actuator_group.h"
+#include "config.h"
+
+#include <assert.h> /* static_assert() */
+#include <string.h> /* memset(), memcpy() */
+
+#include "hardware/gpio.h" /* gpio_init(), gpio_set_dir(), gpio_pull_up(), gpio_get() */
+
+static_assert(SCHEDULE_COMMAND_DEADLINE >= SCHEDULE_TRIGGER_REGION_LENGTH, "Region commands must last at least as long as the region");
+
+void zone_init(struct zone_t* const z, const struct zone_config_t* const conf)
+{
+    memset(z, 0, sizeof(*z));
+    memcpy(&z->conf, conf, sizeof(*conf));
+    gpio_init(z->conf.gpio_select);
+    gpio_set_dir(z->conf.gpio_select, GPIO_IN);
+    gpio_pull_up(z->conf.gpio_select);
+    z->enabled = gpio_get(z->conf.gpio_select) == z->conf.select_active_level;
+}
+
+static struct actuator_group_t zone_group(const struct zone_t* const z, struct actuator_t* const actuators)
+{
+    struct actuator_group_t g = { &actuators[z->conf.actuator_on], &actuators[z->conf.actuator_off], ACTUATOR_GROUP_EXCLUSIVE_ENERGIZE };
+    return g;
+}
+
+void zone_update(struct zone_t* const z, const uint64_t unix_time) { z->state = schedule_cursor_get_state(&z->cursor, unix_time); }
+
+uint64_t zone_next_change(const struct zone_t* const z)
+{
+    uint64_t next = z->state.timestamp_region_next_on < z->state.timestamp_region_next_off ? z->state.timestamp_region_next_on
+                                                                                           : z->state.timestamp_region_next_off;
+    /* An entry only takes effect once its timestamp has passed */
+    if (next != UINT64_MAX)
+        next++;
+    if (z->state.in_region && z->state.timestamp_region_start + SCHEDULE_TRIGGER_REGION_LENGTH < next)
+        next = z->state.timestamp_region_start + SCHEDULE_TRIGGER_REGION_LENGTH;
+    return next;
+}
+
+/** Check if the policy of a zone asks for another cycle in the current region (Given one has already been queued) */
+static bool zone_region_wants_more(const struct zone_t* const z)
+{
+    if (z->region.held_off)
+        return false;
+    switch (z->conf.trigger_policy)
+    {
+    case ZONE_TRIGGER_CYCLES:
+        return z->region.cycles < z->conf.trigger_cycles;
+    case ZONE_TRIGGER_UNTIL_REGION_END:
+        return true;
+    case ZONE_TRIGGER_ONCE_HOLD_OFF:
+        return false;
+    }
+    return false;
+}
+
+void zone_request(struct zone_t* const z, const bool on, const uint64_t deadline)
+{
+    if (!z->command.pending)
+        z->command_stats.requests++;
+    else if (z->command.on == on)
+    {
+        z->command_stats.coalesced++;
+        if (deadline > z->command.deadline)
+            z->command.deadline = deadline;
+        return;
+    }
+    else
+        z->command_stats.superseded++;
+
+    z->command.pending = true;
+    z->command.on = on;
+    z->command.deadline = deadline;
+}
+
+bool zone_poll(struct zone_t* const z, struct actuator_t* const actuators, const uint64_t unix_time)
+{
+    if (!z->enabled)
+        return false;
+
+    const schedule_current_state_t* const s = &z->state;
+    struct zone_region_record_t* const r = &z->region;
+    if (s->in_region && s->timestamp_region_start != r->timestamp_region_start)
+    {
+        r->timestamp_region_start = s->timestamp_region_start;
+        r->on = s->on;
+        r->cycles = 0;
+        r->held_off = z->conf.trigger_policy == ZONE_TRIGGER_ONCE_HOLD_OFF && z->actuated && z->actuated_on == s->on;
+        if (r->held_off)
+            z->command_stats.held_off++;
+        else
+            zone_request(z, s->on, s->timestamp_region_start + SCHEDULE_COMMAND_DEADLINE);
+    }
+    else if (s->in_region && !z->command.pending && zone_region_wants_more(z))
+    {
+        zone_request(z, s->on, s->timestamp_region_start + SCHEDULE_TRIGGER_REGION_LENGTH);
+    }
+
+    if (!z->command.pending)
+        return false;
+    if (unix_time >= z->command.deadline)
+    {
+        z->command.pending = false;
+        z->command_stats.expired++;
+        return false;
+    }
+    const struct actuator_group_t g = zone_group(z, actuators);
+    if (!actuator_group_trigger(&g, z->command.on))
+        return false;
+    z->command.pending = false;
+    z->command_stats.executed++;
+    z->actuated = true;
+    z->actuated_on = z->command.on;
+    if (z->command.on == r->on)
+        r->cycles++;
+    return true;
+}
+
+bool zone_resume(struct zone_t* const z, struct actuator_t* const actuators)
+{
+    if (!z->enabled || !z->state.allow_resume)
+        return false;
+    actuator_trigger(&actuators[z->state.on ? z->conf.actuator_on : z->conf.actuator_off]);
+    z->actuated = true;
+    z->actuated_on = z->state.on;
+    return true;
+}
+
+bool zone_busy(const struct zone_t* const z)
+{
+    if (z->command.pending)
+        return true;
+    if (!z->state.in_region)
+        return false;
+    /* A region that zone_poll() hasn't seen yet is about to queue its first command */
+    return z->state.timestamp_region_start != z->region.timestamp_region_start || zone_region_wants_more(z);
+}
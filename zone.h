@@ -0,0 +1,174 @@
+/**
+ * pico-light-switch - TODO
+ *
+ * @file
+ * @copyright
+ * @parblock
+ * SPDX-License-Identifier: MIT
+ *
+ * SPDX-FileCopyrightText: Copyright (c) 2026 Ian Hangartner <icrashstuff at outlook dot com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ * @endparblock
+ *
+ * @brief Zones: a schedule bound to a select input and a pair of actuators
+ */
+#pragma once
+
+#include "actuator.h"
+#include "schedule.h"
+
+#include <stdbool.h> /* bool */
+#include <stdint.h> /* uint64_t, uint8_t */
+
+/** How often a region of the schedule cycles the actuator (see @ref ZONE_TABLE) */
+enum zone_trigger_policy_t
+{
+    /** zone_config_t::trigger_cycles cycles per region */
+    ZONE_TRIGGER_CYCLES,
+    /** Back to back cycles until the region ends */
+    ZONE_TRIGGER_UNTIL_REGION_END,
+    /** One cycle, following regions of the same state are skipped until the state changes */
+    ZONE_TRIGGER_ONCE_HOLD_OFF,
+};
+
+struct zone_config_t
+{
+    const char* name; ///< Name for status output (eg. "L1")
+    uint8_t gpio_select; ///< GPIO pin that enables the zone
+    bool select_active_level; ///< Logic level `gpio_select` must read at boot for the zone to be enabled
+    uint8_t actuator_on; ///< Index of the actuator that switches the zone "ON"
+    uint8_t actuator_off; ///< Index of the actuator that switches the zone "OFF"
+    enum zone_trigger_policy_t trigger_policy;
+    uint8_t trigger_cycles; ///< Cycles per region with @ref ZONE_TRIGGER_CYCLES
+};
+
+/**
+ * Actuation waiting for the actuators of a zone to be free
+ *
+ * A zone holds at most one: "ON" and "OFF" press different actuators that are coordinated as a group (see
+ * actuator_group.h), and a newer request always makes an older one pointless (see zone_request())
+ */
+struct zone_command_t
+{
+    bool pending;
+    bool on; ///< Actuation to perform (Kept after the command has run)
+    uint64_t deadline; ///< Seconds since 1970 at which the command is dropped
+};
+
+/** Counters of zone_request() and zone_poll() */
+struct zone_command_stats_t
+{
+    uint32_t requests; ///< Commands queued while none was pending
+    uint32_t coalesced; ///< Requests merged into a pending command for the same state
+    uint32_t superseded; ///< Pending commands replaced by a request for the other state
+    uint32_t expired; ///< Commands dropped at their deadline
+    uint32_t executed; ///< Commands that triggered an actuator
+    uint32_t held_off; ///< Regions not requested due to @ref ZONE_TRIGGER_ONCE_HOLD_OFF
+};
+
+/** What zone_poll() did for the current (or last) region, so that every loop over the region doesn't fire again */
+struct zone_region_record_t
+{
+    uint64_t timestamp_region_start; ///< schedule_current_state_t::timestamp_region_start of the region
+    bool on; ///< State of the region
+    bool held_off; ///< Skipped by @ref ZONE_TRIGGER_ONCE_HOLD_OFF
+    uint16_t cycles; ///< Cycles triggered for the region
+};
+
+struct zone_t
+{
+    struct zone_config_t conf;
+    bool enabled;
+    schedule_cursor_t cursor;
+    /** Result of the last zone_update() */
+    schedule_current_state_t state;
+    struct zone_command_t command;
+    struct zone_command_stats_t command_stats;
+    struct zone_region_record_t region;
+    /** Whether an actuation has run since zone_init(), and for which state */
+    bool actuated;
+    bool actuated_on;
+};
+
+/**
+ * Initialize a zone and read its select input
+ *
+ * NOTE: The schedule cursor is left for the caller to initialize
+ *
+ * @param z Zone object to initialize
+ * @param conf Configuration for zone
+ */
+void zone_init(struct zone_t* const z, const struct zone_config_t* const conf);
+
+/**
+ * Evaluate the schedule of a zone
+ *
+ * @param unix_time Seconds since 1970
+ */
+void zone_update(struct zone_t* const z, const uint64_t unix_time);
+
+/**
+ * Get the next time the state of a zone changes (After the next "ON"/"OFF" entry has passed, or at the end of the current region)
+ *
+ * @returns Seconds since 1970, or UINT64_MAX if the state never changes again
+ */
+uint64_t zone_next_change(const struct zone_t* const z);
+
+/**
+ * Queue an actuation, to run as soon as its actuator is idle
+ *
+ * A request for the state already pending collapses into it (keeping the later deadline), a request for the other state
+ * replaces it
+ *
+ * @param on Actuation to perform
+ * @param deadline Seconds since 1970 at which the command is dropped
+ */
+void zone_request(struct zone_t* const z, const bool on, const uint64_t deadline);
+
+/**
+ * Queue the actuation for the current region, and run the pending command once its actuator is idle
+ *
+ * The other actuator may still be moving, see actuator_group.h for when the two move in parallel
+ *
+ * The first command of a region lasts until @ref SCHEDULE_COMMAND_DEADLINE, the repeats that zone_config_t::trigger_policy
+ * asks for only until the region ends. Nothing is queued or run while the zone is disabled.
+ *
+ * @param actuators Actuator array indexed by zone_config_t::actuator_on and zone_config_t::actuator_off
+ * @param unix_time Seconds since 1970
+ *
+ * @returns True if an actuator was triggered (for zone_command_t::on)
+ */
+bool zone_poll(struct zone_t* const z, struct actuator_t* const actuators, const uint64_t unix_time);
+
+/**
+ * Trigger the actuator for the current state if the zone is enabled and the current state allows resuming
+ *
+ * @param actuators Actuator array indexed by zone_config_t::actuator_on and zone_config_t::actuator_off
+ *
+ * @returns True if an actuator was triggered
+ */
+bool zone_resume(struct zone_t* const z, struct actuator_t* const actuators);
+
+/**
+ * Check if a zone has actuations queued or still to come in the current region
+ *
+ * Core 1 has to act at any time while this is true
+ */
+bool zone_busy(const struct zone_t* const z);